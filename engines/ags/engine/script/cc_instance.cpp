@@ -460,87 +460,82 @@ int ccInstance::Run(int32_t curpc) {
 	//const auto timeout_abort = std::chrono::milliseconds(_G(timeoutAbortMs));
 	_lastAliveTs = AGS_Clock::now();
 
+	// The fixed up code is translated once, on the first run of the instance
+	if (!codeInst->codeOps)
+		codeInst->TranslateCode();
+	const ScriptCodeOps &ops = *codeInst->codeOps;
+
 	while ((flags & INSTF_ABORTED) == 0) {
 		if (_G(abort_engine))
 			return -1;
 
-		/*
-		if (!codeInst->ReadOperation(codeOp, pc))
-		{
-		    return -1;
-		}
-		*/
-		/* ReadOperation */
-		//=====================================================================
-		codeOp.Instruction.Code         = codeInst->code[pc];
-		codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
-		codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
-
-		if (codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS) {
-			cc_error("invalid instruction %d found in code stream", codeOp.Instruction.Code);
+		// Fetch the pre-decoded instruction
+		int32_t opIndex = (pc >= 0 && pc < codeInst->codesize) ? ops.PcToOp[pc] : -1;
+		if (opIndex < 0) {
+			cc_error("invalid instruction found in code stream at %d", pc);
 			return -1;
 		}
-
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
-		if (pc + codeOp.ArgCount >= codeInst->codesize) {
-			cc_error("unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
-			return -1;
+		const ScriptCodeOp *op = &ops.Ops[opIndex];
+
+		// Line numbers only matter for the script position, so unless someone
+		// is watching them they are folded into the following instruction
+		if (!write_debug_dump && !_G(new_line_hook)) {
+			while (op->Code == SCMD_LINENUM) {
+				line_number = (int32_t)op->ArgValues[0];
+				_G(currentline) = line_number;
+				pc += 2;
+
+				opIndex = (pc < codeInst->codesize) ? ops.PcToOp[pc] : -1;
+				if (opIndex < 0) {
+					cc_error("invalid instruction found in code stream at %d", pc);
+					return -1;
+				}
+				op = &ops.Ops[opIndex];
+			}
 		}
 
-		int pc_at = pc + 1;
-		for (int i = 0; i < codeOp.ArgCount; ++i, ++pc_at) {
-			char fixup = codeInst->code_fixups[pc_at];
-			if (fixup > 0) {
-				// could be relative pointer or import address
-				/*
-				if (!FixupArgument(code[pc], fixup, codeOp.Args[i]))
-				{
-				    return -1;
-				}
-				*/
-				/* FixupArgument */
-				//=====================================================================
-				switch (fixup) {
+		codeOp.Instruction.Code       = op->Code;
+		codeOp.Instruction.InstanceId = op->InstanceId;
+		codeOp.ArgCount               = op->ArgCount;
+
+		if (!op->HasFixups) {
+			// should be numeric literals (int32 or float)
+			for (int i = 0; i < op->ArgCount; ++i)
+				codeOp.Args[i].SetInt32((int32_t)op->ArgValues[i]);
+		} else {
+			for (int i = 0; i < op->ArgCount; ++i) {
+				switch (op->ArgFixups[i]) {
 				case FIXUP_GLOBALDATA: {
-					ScriptVariable *gl_var = (ScriptVariable *)codeInst->code[pc_at];
+					ScriptVariable *gl_var = (ScriptVariable *)op->ArgValues[i];
 					codeOp.Args[i].SetGlobalVar(&gl_var->RValue);
 				}
 				break;
-				case FIXUP_FUNCTION:
-					// originally commented -- CHECKME: could this be used in very old versions of AGS?
-					//      code[fixup] += (long)&code[0];
-					// This is a program counter value, presumably will be used as SCMD_CALL argument
-					codeOp.Args[i].SetInt32((int32_t)codeInst->code[pc_at]);
-					break;
 				case FIXUP_STRING:
-					codeOp.Args[i].SetStringLiteral(&codeInst->strings[0] + codeInst->code[pc_at]);
+					codeOp.Args[i].SetStringLiteral((const char *)op->ArgValues[i]);
 					break;
 				case FIXUP_IMPORT: {
-					const ScriptImport *import = _GP(simp).getByIndex(static_cast<uint32_t>(codeInst->code[pc_at]));
+					const ScriptImport *import = _GP(simp).getByIndex(static_cast<uint32_t>(op->ArgValues[i]));
 					if (import) {
 						codeOp.Args[i] = import->Value;
 					} else {
-						cc_error("cannot resolve import, key = %ld", codeInst->code[pc_at]);
+						cc_error("cannot resolve import, key = %ld", op->ArgValues[i]);
 						return -1;
 					}
 				}
 				break;
 				case FIXUP_STACK:
-					codeOp.Args[i] = GetStackPtrOffsetFw((int32_t)codeInst->code[pc_at]);
+					codeOp.Args[i] = GetStackPtrOffsetFw((int32_t)op->ArgValues[i]);
+					break;
+				case 0:
+					// should be a numeric literal (int32 or float)
+					codeOp.Args[i].SetInt32((int32_t)op->ArgValues[i]);
 					break;
 				default:
-					cc_error("internal fixup type error: %d", fixup);
+					cc_error("internal fixup type error: %d", op->ArgFixups[i]);
 					return -1;
 				}
-				/* End FixupArgument */
-				//=====================================================================
-			} else {
-				// should be a numeric literal (int32 or float)
-				codeOp.Args[i].SetInt32((int32_t)codeInst->code[pc_at]);
 			}
 		}
-		/* End ReadOperation */
-		//=====================================================================
 
 		// save the arguments for quick access
 		RuntimeScriptValue &arg1 = codeOp.Args[0];
@@ -1378,6 +1373,7 @@ bool ccInstance::_Create(PScript scri, ccInstance *joined) {
 		globaldata = joined->globaldata;
 		code = joined->code;
 		codesize = joined->codesize;
+		codeOps = joined->codeOps;
 	} else {
 		// create own memory space
 		// NOTE: globalvars are created in CreateGlobalVars()
@@ -1499,6 +1495,7 @@ void ccInstance::Free() {
 		nullfree(code);
 	}
 	globalvars.reset();
+	codeOps.reset();
 	globaldata = nullptr;
 	code = nullptr;
 	strings = nullptr;
@@ -1726,9 +1723,54 @@ bool ccInstance::ResolveImportFixups(const ccScript *scri) {
 		if (import->InstancePtr != nullptr && (code[fixup + 1] & INSTANCE_ID_REMOVEMASK) == SCMD_CALLEXT)
 			code[fixup + 1] = SCMD_CALLAS | (import->InstancePtr->loadedInstanceId << INSTANCE_ID_SHIFT);
 	}
+	// the code was changed, so it has to be translated again
+	codeOps.reset();
 	return true;
 }
 
+void ccInstance::TranslateCode() {
+	codeOps.reset(new ScriptCodeOps());
+	codeOps->PcToOp.resize(codesize, -1);
+
+	// The instructions are decoded in sequence; if the code is broken, the
+	// rest of it is left untranslated, and reported once it's reached
+	for (int32_t at_pc = 0; at_pc < codesize;) {
+		ScriptCodeOp op;
+		op.Code       = code[at_pc];
+		op.InstanceId = (op.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
+		op.Code      &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
+
+		if (op.Code < 0 || op.Code >= CC_NUM_SCCMDS)
+			break;
+
+		op.ArgCount = (*g_commands)[op.Code].ArgCount;
+		if (at_pc + op.ArgCount >= codesize)
+			break;
+
+		for (int i = 0; i < op.ArgCount; ++i) {
+			const int32_t arg_pc = at_pc + 1 + i;
+			char fixup = code_fixups[arg_pc];
+			intptr_t value = code[arg_pc];
+
+			if (fixup == FIXUP_STRING) {
+				value = (intptr_t)(&strings[0] + value);
+			} else if (fixup == FIXUP_FUNCTION) {
+				// This is a program counter value, presumably will be used as
+				// SCMD_CALL argument, so it's the same as a numeric literal
+				fixup = 0;
+			}
+
+			op.ArgFixups[i] = fixup;
+			op.ArgValues[i] = value;
+			op.HasFixups |= (fixup != 0);
+		}
+
+		codeOps->PcToOp[at_pc] = (int32_t)codeOps->Ops.size();
+		codeOps->Ops.push_back(op);
+		at_pc += op.ArgCount + 1;
+	}
+}
+
 /*
 bool ccInstance::ReadOperation(ScriptOperation &op, int32_t at_pc)
 {
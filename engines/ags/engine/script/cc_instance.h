@@ -24,6 +24,7 @@
 
 #include "common/std/memory.h"
 #include "common/std/map.h"
+#include "common/std/vector.h"
 #include "ags/engine/ac/timer.h"
 #include "ags/shared/script/cc_internal.h"
 #include "ags/shared/script/cc_script.h"  // ccScript
@@ -69,6 +70,29 @@ struct ScriptOperation {
 	int                 ArgCount;
 };
 
+// Pre-decoded instruction, as prepared by the load-time translation pass:
+// the instruction code is split from the instance id, the argument count is
+// looked up, and every argument keeps its fixup type next to its value.
+// Fixups which don't depend on the execution state are resolved already,
+// so that only the import and stack ones are left to do at runtime.
+struct ScriptCodeOp {
+	int32_t  Code = 0;
+	int32_t  InstanceId = 0;
+	int32_t  ArgCount = 0;
+	bool     HasFixups = false;
+	char     ArgFixups[MAX_SCMD_ARGS] = {};
+	intptr_t ArgValues[MAX_SCMD_ARGS] = {};
+};
+
+// The translated code of a script instance; shared with its forks
+struct ScriptCodeOps {
+	std::vector<ScriptCodeOp> Ops;
+	// index into Ops for each code position, -1 where no instruction starts
+	std::vector<int32_t> PcToOp;
+};
+
+typedef std::shared_ptr<ScriptCodeOps> PScriptCodeOps;
+
 struct ScriptVariable {
 	ScriptVariable() {
 		ScAddress = -1; // address = 0 is valid one, -1 means undefined
@@ -140,6 +164,9 @@ public:
 
 	char *code_fixups;
 
+	// pre-decoded instruction stream, built on first run
+	PScriptCodeOps codeOps;
+
 	// returns the currently executing instance, or NULL if none
 	static ccInstance *GetCurrentInstance(void);
 	// clears recorded stack of current instances
@@ -193,6 +220,8 @@ private:
 	bool    AddGlobalVar(const ScriptVariable &glvar);
 	ScriptVariable *FindGlobalVar(int32_t var_addr);
 	bool    CreateRuntimeCodeFixups(const ccScript *scri);
+	// Translate the fixed up code into the pre-decoded instruction stream
+	void    TranslateCode();
 	//bool    ReadOperation(ScriptOperation &op, int32_t at_pc);
 
 	// Begin executing script starting from the given bytecode index
@@ -247,6 +247,7 @@ MODULE_OBJS = \
 	shape.o \
 	slice_animations.o \
 	slice_renderer.o \
+	slice_span.o \
 	subtitles.o \
 	suspects_database.o \
 	text_resource.o \
@@ -282,6 +283,16 @@ MODULE_OBJS = \
 	waypoints.o \
 	zbuffer.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	slice_span_neon.o
+endif
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	slice_span_sse2.o
+endif
+
 # This module can be built as a plugin
 ifeq ($(ENABLE_BLADERUNNER), DYNAMIC_PLUGIN)
 PLUGIN := 1
@@ -36,6 +36,7 @@ namespace BladeRunner {
 SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_vm = vm;
 	_pixelFormat = screenPixelFormat();
+	initSliceSpanOps(_spanOps);
 
 	// original game is going just up to 942 and not 997
 	for (int i = 0; i < ARRAYSIZE(_animationsShadowEnabled); ++i) {
@@ -585,12 +586,21 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufferLine[x]) {
-							zbufferLine[x] = (uint16)vertexZ;
-
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
+					if (vertexX <= surface.w && surface.format.bytesPerPixel == 2) {
+						// The whole run is on the surface, no clipping needed
+						uint16 *dstPtr = (uint16 *)surface.getBasePtr(previousVertexX, CLIP(y, 0, surface.h - 1));
+						_spanOps.zFill16(dstPtr, zbufferLine + previousVertexX, vertexX - previousVertexX, (uint16)vertexZ, (uint16)outColor);
+					} else if (vertexX <= surface.w && surface.format.bytesPerPixel == 4) {
+						uint32 *dstPtr = (uint32 *)surface.getBasePtr(previousVertexX, CLIP(y, 0, surface.h - 1));
+						_spanOps.zFill32(dstPtr, zbufferLine + previousVertexX, vertexX - previousVertexX, (uint16)vertexZ, outColor);
+					} else {
+						for (int x = previousVertexX; x != vertexX; ++x) {
+							if (vertexZ < zbufferLine[x]) {
+								zbufferLine[x] = (uint16)vertexZ;
+
+								void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
+								drawPixel(surface, dstPtr, outColor);
+							}
 						}
 					}
 				}
@@ -23,6 +23,7 @@
 #define BLADERUNNER_SLICE_RENDERER_H
 
 #include "bladerunner/color.h"
+#include "bladerunner/slice_span.h"
 #include "bladerunner/vector.h"
 #include "bladerunner/view.h"
 #include "bladerunner/matrix.h"
@@ -89,6 +90,7 @@ class SliceRenderer {
 	Color _lightsColor;
 
 	Graphics::PixelFormat _pixelFormat;
+	SliceSpanOps          _spanOps;
 
 public:
 	SliceRenderer(BladeRunnerEngine *vm);
@@ -0,0 +1,60 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/system.h"
+#include "bladerunner/slice_span.h"
+
+namespace BladeRunner {
+
+static void sliceZFill16(uint16 *dst, uint16 *zbuffer, int size, uint16 z, uint16 color) {
+	for (int i = 0; i < size; ++i) {
+		if (z < zbuffer[i]) {
+			zbuffer[i] = z;
+			dst[i] = color;
+		}
+	}
+}
+
+static void sliceZFill32(uint32 *dst, uint16 *zbuffer, int size, uint16 z, uint32 color) {
+	for (int i = 0; i < size; ++i) {
+		if (z < zbuffer[i]) {
+			zbuffer[i] = z;
+			dst[i] = color;
+		}
+	}
+}
+
+void initSliceSpanOps(SliceSpanOps &ops) {
+	ops.zFill16 = sliceZFill16;
+	ops.zFill32 = sliceZFill32;
+
+#ifdef SCUMMVM_NEON
+	if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		initSliceSpanOpsNEON(ops);
+#endif
+
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		initSliceSpanOpsSSE2(ops);
+#endif
+}
+
+} // End of namespace BladeRunner
@@ -0,0 +1,53 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BLADERUNNER_SLICE_SPAN_H
+#define BLADERUNNER_SLICE_SPAN_H
+
+#include "common/scummsys.h"
+
+namespace BladeRunner {
+
+// Writers for the runs of a slice polygon line, which share one depth and
+// one colour. Every pixel whose z-buffer value is greater than z is set to
+// color and its z-buffer value replaced with z, like the per pixel loop of
+// SliceRenderer::drawSlice() does.
+//
+// The table is filled with the portable implementations first, then the
+// entries are swapped for the vectorized ones the host CPU supports.
+struct SliceSpanOps {
+	void (*zFill16)(uint16 *dst, uint16 *zbuffer, int size, uint16 z, uint16 color);
+	void (*zFill32)(uint32 *dst, uint16 *zbuffer, int size, uint16 z, uint32 color);
+};
+
+void initSliceSpanOps(SliceSpanOps &ops);
+
+#ifdef SCUMMVM_SSE2
+void initSliceSpanOpsSSE2(SliceSpanOps &ops);
+#endif
+
+#ifdef SCUMMVM_NEON
+void initSliceSpanOpsNEON(SliceSpanOps &ops);
+#endif
+
+} // End of namespace BladeRunner
+
+#endif
@@ -0,0 +1,105 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(ENABLE_BLADERUNNER) && defined(SCUMMVM_NEON)
+
+#include "bladerunner/slice_span.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__)
+
+namespace BladeRunner {
+
+static void sliceZFill16NEON(uint16 *dst, uint16 *zbuffer, int size, uint16 z, uint16 color) {
+	const uint16x8_t zv = vdupq_n_u16(z);
+	const uint16x8_t c = vdupq_n_u16(color);
+
+	for (; size >= 8; size -= 8, dst += 8, zbuffer += 8) {
+		uint16x8_t zb = vld1q_u16(zbuffer);
+		uint16x8_t mask = vcltq_u16(zv, zb);
+		uint16x8_t d = vld1q_u16(dst);
+		vst1q_u16(zbuffer, vbslq_u16(mask, zv, zb));
+		vst1q_u16(dst, vbslq_u16(mask, c, d));
+	}
+
+	for (int i = 0; i < size; ++i) {
+		if (z < zbuffer[i]) {
+			zbuffer[i] = z;
+			dst[i] = color;
+		}
+	}
+}
+
+static void sliceZFill32NEON(uint32 *dst, uint16 *zbuffer, int size, uint16 z, uint32 color) {
+	const uint16x8_t zv = vdupq_n_u16(z);
+	const uint32x4_t c = vdupq_n_u32(color);
+
+	for (; size >= 8; size -= 8, dst += 8, zbuffer += 8) {
+		uint16x8_t zb = vld1q_u16(zbuffer);
+		uint16x8_t mask = vcltq_u16(zv, zb);
+		// Widen the word mask to cover the four pixels of each half
+		uint32x4_t maskLo = vreinterpretq_u32_s32(vmovl_s16(vreinterpret_s16_u16(vget_low_u16(mask))));
+		uint32x4_t maskHi = vreinterpretq_u32_s32(vmovl_s16(vreinterpret_s16_u16(vget_high_u16(mask))));
+		uint32x4_t dLo = vld1q_u32(dst);
+		uint32x4_t dHi = vld1q_u32(dst + 4);
+		vst1q_u16(zbuffer, vbslq_u16(mask, zv, zb));
+		vst1q_u32(dst, vbslq_u32(maskLo, c, dLo));
+		vst1q_u32(dst + 4, vbslq_u32(maskHi, c, dHi));
+	}
+
+	for (int i = 0; i < size; ++i) {
+		if (z < zbuffer[i]) {
+			zbuffer[i] = z;
+			dst[i] = color;
+		}
+	}
+}
+
+void initSliceSpanOpsNEON(SliceSpanOps &ops) {
+	ops.zFill16 = sliceZFill16NEON;
+	ops.zFill32 = sliceZFill32NEON;
+}
+
+} // End of namespace BladeRunner
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__)
+
+#endif // ENABLE_BLADERUNNER && SCUMMVM_NEON
@@ -0,0 +1,125 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(ENABLE_BLADERUNNER) && defined(SCUMMVM_SSE2)
+
+#include "bladerunner/slice_span.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace BladeRunner {
+
+static FORCEINLINE __m128i select(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// SSE2 only compares signed words, flipping the sign bit of both sides
+// turns that into the unsigned z < zbuffer test
+static FORCEINLINE __m128i zLess(__m128i zBiased, __m128i zb, __m128i bias) {
+	return _mm_cmplt_epi16(zBiased, _mm_xor_si128(zb, bias));
+}
+
+static void sliceZFill16SSE2(uint16 *dst, uint16 *zbuffer, int size, uint16 z, uint16 color) {
+	const __m128i bias = _mm_set1_epi16((short)0x8000);
+	const __m128i zv = _mm_set1_epi16((short)z);
+	const __m128i zBiased = _mm_xor_si128(zv, bias);
+	const __m128i c = _mm_set1_epi16((short)color);
+
+	for (; size >= 8; size -= 8, dst += 8, zbuffer += 8) {
+		__m128i zb = _mm_loadu_si128((const __m128i *)zbuffer);
+		__m128i mask = zLess(zBiased, zb, bias);
+		if (_mm_movemask_epi8(mask) == 0)
+			continue;
+
+		__m128i d = _mm_loadu_si128((const __m128i *)dst);
+		_mm_storeu_si128((__m128i *)zbuffer, select(mask, zv, zb));
+		_mm_storeu_si128((__m128i *)dst, select(mask, c, d));
+	}
+
+	for (int i = 0; i < size; ++i) {
+		if (z < zbuffer[i]) {
+			zbuffer[i] = z;
+			dst[i] = color;
+		}
+	}
+}
+
+static void sliceZFill32SSE2(uint32 *dst, uint16 *zbuffer, int size, uint16 z, uint32 color) {
+	const __m128i bias = _mm_set1_epi16((short)0x8000);
+	const __m128i zv = _mm_set1_epi16((short)z);
+	const __m128i zBiased = _mm_xor_si128(zv, bias);
+	const __m128i c = _mm_set1_epi32((int)color);
+
+	for (; size >= 8; size -= 8, dst += 8, zbuffer += 8) {
+		__m128i zb = _mm_loadu_si128((const __m128i *)zbuffer);
+		__m128i mask = zLess(zBiased, zb, bias);
+		if (_mm_movemask_epi8(mask) == 0)
+			continue;
+
+		// Widen the word mask to cover the four pixels of each half
+		__m128i maskLo = _mm_unpacklo_epi16(mask, mask);
+		__m128i maskHi = _mm_unpackhi_epi16(mask, mask);
+		__m128i dLo = _mm_loadu_si128((const __m128i *)dst);
+		__m128i dHi = _mm_loadu_si128((const __m128i *)(dst + 4));
+		_mm_storeu_si128((__m128i *)zbuffer, select(mask, zv, zb));
+		_mm_storeu_si128((__m128i *)dst, select(maskLo, c, dLo));
+		_mm_storeu_si128((__m128i *)(dst + 4), select(maskHi, c, dHi));
+	}
+
+	for (int i = 0; i < size; ++i) {
+		if (z < zbuffer[i]) {
+			zbuffer[i] = z;
+			dst[i] = color;
+		}
+	}
+}
+
+void initSliceSpanOpsSSE2(SliceSpanOps &ops) {
+	ops.zFill16 = sliceZFill16SSE2;
+	ops.zFill32 = sliceZFill32SSE2;
+}
+
+} // End of namespace BladeRunner
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // ENABLE_BLADERUNNER && SCUMMVM_SSE2
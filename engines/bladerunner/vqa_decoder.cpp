@@ -138,6 +138,7 @@ VQADecoder::VQADecoder() {
 	_header.unk5         = 0;
 	_readingFrame        = -1;
 	_decodingFrame       = -1;
+	_prefetchedFrameNext = 0;
 	_vqpPalsArr          = nullptr;
 	_numOfVQPPalettes    = 0;
 	_oldV2VQA                 = false;
@@ -281,13 +282,66 @@ void VQADecoder::readFrame(int frame, uint readFlags) {
 		error("VQADecoder::readFrame(): frame %d out of bounds, frame count is %d", frame, numFrames());
 	}
 
+	_readingFrame = frame;
+
+	for (int i = 0; i < kPrefetchFrameCount; ++i) {
+		PrefetchedFrame &prefetched = _prefetchedFrames[i];
+		if (prefetched.frame == frame) {
+			Common::MemoryReadStream packet(prefetched.data.data(), prefetched.data.size());
+			Common::SeekableReadStream *s = _s;
+			_s = &packet;
+			readPacket(readFlags);
+			_s = s;
+			return;
+		}
+	}
+
 	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
 	_s->seek(frameOffset);
 
-	_readingFrame = frame;
 	readPacket(readFlags);
 }
 
+// Returns true only when the packet had to be read from the stream
+bool VQADecoder::prefetchFrame(int frame) {
+	if (frame < 0 || frame >= numFrames()) {
+		return false;
+	}
+
+	for (int i = 0; i < kPrefetchFrameCount; ++i) {
+		if (_prefetchedFrames[i].frame == frame) {
+			return false;
+		}
+	}
+
+	// A packet ends where the one of the next frame starts
+	int32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+	int32 frameEnd = frame + 1 < numFrames() ? 2 * (_frameInfo[frame + 1] & 0x0FFFFFFF) : _s->size();
+	if (frameEnd <= frameOffset || frameEnd > _s->size()) {
+		return false;
+	}
+
+	PrefetchedFrame &prefetched = _prefetchedFrames[_prefetchedFrameNext];
+	_prefetchedFrameNext = (_prefetchedFrameNext + 1) % kPrefetchFrameCount;
+
+	prefetched.data.resize(frameEnd - frameOffset);
+	_s->seek(frameOffset);
+	if (_s->read(prefetched.data.data(), prefetched.data.size()) != prefetched.data.size()) {
+		prefetched.frame = -1;
+		return false;
+	}
+
+	prefetched.frame = frame;
+	return true;
+}
+
+void VQADecoder::dropPrefetchedFrames() {
+	for (int i = 0; i < kPrefetchFrameCount; ++i) {
+		_prefetchedFrames[i].frame = -1;
+	}
+	_prefetchedFrameNext = 0;
+}
+
 bool VQADecoder::readVQHD(Common::SeekableReadStream *s, uint32 size) {
 	if (size != 42)
 		return false;
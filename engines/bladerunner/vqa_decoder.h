@@ -67,6 +67,9 @@ public:
 
 	void readFrame(int frame, uint readFlags = kVQAReadAll);
 
+	bool prefetchFrame(int frame);
+	void dropPrefetchedFrames();
+
 	void                        decodeVideoFrame(Graphics::Surface *surface, int frame, bool forceDraw = false);
 	void                        decodeZBuffer(ZBuffer *zbuffer);
 	Audio::SeekableAudioStream *decodeAudioFrame();
@@ -145,6 +148,17 @@ public:
 		uint8  *data;
 	};
 
+	// Raw packet of an upcoming frame, read in one go ahead of time
+	// so that readFrame() does not have to go to the disk for it.
+	struct PrefetchedFrame {
+		int                  frame;
+		Common::Array<uint8> data;
+
+		PrefetchedFrame() : frame(-1) {}
+	};
+
+	static const int kPrefetchFrameCount = 8;
+
 	class VQAVideoTrack;
 	class VQAAudioTrack;
 
@@ -169,6 +183,9 @@ public:
 
 	uint32  *_frameInfo;
 
+	PrefetchedFrame _prefetchedFrames[kPrefetchFrameCount];
+	int             _prefetchedFrameNext; // slot to be reused by the next prefetch
+
 	uint32   _maxVIEWChunkSize;
 	uint32   _maxZBUFChunkSize;
 	uint32   _maxAESCChunkSize;
@@ -110,6 +110,7 @@ bool VQAPlayer::open() {
 
 void VQAPlayer::close() {
 	_vm->_mixer->stopHandle(_soundHandle);
+	_decoder.dropPrefetchedFrames();
 	delete _s;
 	_s = nullptr;
 }
@@ -271,6 +272,8 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 	} else if (useTime && (now - (_frameNextTime - kVqaFrameTimeDiff) < kVqaFrameTimeDiff)) {
 		// Not yet time to move to next frame.
 		// Note, we use unsigned difference to avoid potential time overflow issues
+		// Use the wait to read ahead the frames that are coming up.
+		prefetchFrames();
 		result = -1;
 
 	} else if (advanceFrame) {
@@ -448,10 +451,14 @@ bool VQAPlayer::setBeginAndEndFrame(int begin, int end, int repeatsCount, int lo
 	_callbackLoopEnded = callback;
 	_callbackData = callbackData;
 
+	// The frames read ahead may no longer be the ones that come next
+	_decoder.dropPrefetchedFrames();
+
 	return true;
 }
 
 bool VQAPlayer::seekToFrame(int frame) {
+	_decoder.dropPrefetchedFrames();
 	_frameNext = frame;
 	_frameNextTime = 60 * _vm->_time->currentSystem();
 	return true;
@@ -494,6 +501,36 @@ int VQAPlayer::getQueuedAudioFrames() const {
 	return _audioStream->numQueuedStreams();
 }
 
+// Reads the packet of one of the frames that are about to be played,
+// following the current loop into the next one, so that the frame
+// ticks do not have to wait for the disk.
+void VQAPlayer::prefetchFrames() {
+	int frame = _frameNext < 0 ? _frameBeginNext : _frameNext;
+	int end = _frameEnd;
+	bool wrapped = false;
+
+	for (int i = 0; i < VQADecoder::kPrefetchFrameCount; ++i, ++frame) {
+		if (frame > end) {
+			if (wrapped || _frameBeginNext < 0 || (_repeatsCount == 0 && _frameEndQueued == -1)) {
+				return;
+			}
+			frame = _frameBeginNext;
+			if (_frameEndQueued != -1) {
+				end = _frameEndQueued;
+			}
+			wrapped = true;
+		}
+
+		if (frame < 0 || frame >= getFrameCount()) {
+			return;
+		}
+
+		if (_decoder.prefetchFrame(frame)) {
+			return;
+		}
+	}
+}
+
 // Adds another audio "frame" to the queue of the audio stream
 void VQAPlayer::queueAudioFrame(Audio::AudioStream *audioStream) {
 	if (audioStream == nullptr) {
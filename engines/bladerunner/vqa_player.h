@@ -152,6 +152,7 @@ public:
 
 private:
 	void queueAudioFrame(Audio::AudioStream *audioStream);
+	void prefetchFrames();
 };
 
 } // End of namespace BladeRunner
@@ -79,6 +79,7 @@ static const DebugChannelDef debugFlagList[] = {
 	{Director::kDebugImGui, "imgui", "Show ImGui debug window (if available)"},
 	{Director::kDebugPaused, "paused", "Pause first movie right after start"},
 	{Director::kDebugPauseOnLoad, "pauseonload", "Pause every movie right after loading"},
+	{Director::kDebugLingoBench, "lingobench", "Benchmark the Lingo test scripts"},
 	DEBUG_CHANNEL_END
 };
 
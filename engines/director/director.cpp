@@ -76,6 +76,7 @@ DirectorEngine::DirectorEngine(OSystem *syst, const DirectorGameDescription *gam
 
 	// Load Patterns
 	loadPatterns();
+	initInkSpanOps(_inkSpanOps);
 
 	// Load key codes
 	loadKeyCodes();
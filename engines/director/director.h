@@ -26,6 +26,7 @@
 
 #include "graphics/macgui/macwindowmanager.h"
 
+#include "director/inkspan.h"
 #include "director/types.h"
 #include "director/util.h"
 #include "director/detection.h"
@@ -88,6 +89,7 @@ enum {
 	kDebugImGui,
 	kDebugPaused,
 	kDebugPauseOnLoad,
+	kDebugLingoBench,
 };
 
 enum {
@@ -248,6 +250,7 @@ public:
 	RandomState _rnd;
 	Graphics::MacWindowManager *_wm;
 	Graphics::PixelFormat _pixelformat;
+	InkSpanOps32 _inkSpanOps;
 
 	uint32 _debugDraw = 0;
 	int _defaultVolume = 255;
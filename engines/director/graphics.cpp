@@ -676,6 +676,248 @@ void DirectorPlotData::inkBlitShape(Common::Rect &srcRect) {
 	}
 }
 
+// Whole-span ink kernels, used by inkBlitSurface() for runs of unmasked
+// pixels. They produce the same result as calling inkDrawPixel() for each
+// pixel of the run, without the per-pixel dispatch and bounds checks.
+struct InkSpanContext {
+	DirectorPlotData *p;
+	Graphics::MacWindowManager *wm;
+	uint32 key;
+	uint32 color;
+	uint32 rgbMask;
+	uint32 alphaFill;
+	InkSpan32Proc proc32;
+};
+
+typedef void (*InkSpanPtr)(const InkSpanContext &ctx, byte *dst, const byte *src, int size);
+
+template <typename T>
+static void inkSpanCopy(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	memcpy(dst, src, size * sizeof(T));
+}
+
+// Copies every pixel that is not ctx.key
+template <typename T>
+static void inkSpanKeyedCopy(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	T *d = (T *)dst;
+	const T *s = (const T *)src;
+
+	for (int i = 0; i < size; i++)
+		if (s[i] != ctx.key)
+			d[i] = s[i];
+}
+
+// Paints ctx.color wherever the source is ctx.key
+template <typename T>
+static void inkSpanKeyedFill(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	T *d = (T *)dst;
+	const T *s = (const T *)src;
+
+	for (int i = 0; i < size; i++)
+		if (s[i] == ctx.key)
+			d[i] = ctx.color;
+}
+
+// Reduces the source to the foreground and background colors, 8bpp only
+static void inkSpanColorize(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	for (int i = 0; i < size; i++) {
+		if (src[i] == 0xff)
+			dst[i] = ctx.p->foreColor;
+		else if (src[i] == 0x00)
+			dst[i] = ctx.p->backColor;
+	}
+}
+
+struct InkOpOr {
+	template <typename T> static T apply(T s, T d) { return d | s; }
+};
+
+struct InkOpOrNot {
+	template <typename T> static T apply(T s, T d) { return d | ~s; }
+};
+
+struct InkOpXor {
+	template <typename T> static T apply(T s, T d) { return d ^ s; }
+};
+
+struct InkOpXorNot {
+	template <typename T> static T apply(T s, T d) { return d ^ ~s; }
+};
+
+struct InkOpAnd {
+	template <typename T> static T apply(T s, T d) { return d & s; }
+};
+
+struct InkOpAndNot {
+	template <typename T> static T apply(T s, T d) { return d & ~s; }
+};
+
+template <typename T, class Op>
+static void inkSpanBitwise(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	T *d = (T *)dst;
+	const T *s = (const T *)src;
+
+	for (int i = 0; i < size; i++)
+		d[i] = Op::apply(s[i], d[i]);
+}
+
+template <typename T, class Op>
+static void inkSpanArithmetic(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	T *d = (T *)dst;
+	const T *s = (const T *)src;
+
+	for (int i = 0; i < size; i++) {
+		byte rSrc, gSrc, bSrc;
+		byte rDst, gDst, bDst;
+
+		ctx.wm->decomposeColor<T>(s[i], rSrc, gSrc, bSrc);
+		ctx.wm->decomposeColor<T>(d[i], rDst, gDst, bDst);
+
+		d[i] = ctx.wm->findBestColor(Op::apply(rSrc, rDst), Op::apply(gSrc, gDst), Op::apply(bSrc, bDst));
+	}
+}
+
+template <typename T>
+static void inkSpanBlend(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	T *d = (T *)dst;
+	const T *s = (const T *)src;
+
+	for (int i = 0; i < size; i++) {
+		byte rSrc, gSrc, bSrc;
+		byte rDst, gDst, bDst;
+
+		ctx.wm->decomposeColor<T>(s[i], rSrc, gSrc, bSrc);
+		ctx.wm->decomposeColor<T>(d[i], rDst, gDst, bDst);
+
+		d[i] = ctx.wm->findBestColor(lerpByte(rSrc, rDst, ctx.p->alpha, 255),
+									lerpByte(gSrc, gDst, ctx.p->alpha, 255),
+									lerpByte(bSrc, bDst, ctx.p->alpha, 255));
+	}
+}
+
+static void inkSpanArithmetic32(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	ctx.proc32((uint32 *)dst, (const uint32 *)src, size, ctx.rgbMask, ctx.alphaFill);
+}
+
+static void inkSpanBlend32(const InkSpanContext &ctx, byte *dst, const byte *src, int size) {
+	ctx.p->d->_inkSpanOps.blend((uint32 *)dst, (const uint32 *)src, size, ctx.p->alpha, ctx.rgbMask, ctx.alphaFill);
+}
+
+template <typename T>
+static InkSpanPtr getArithmeticInkSpan(InkSpanContext &ctx, bool byteChannels) {
+	const InkSpanOps32 &ops = ctx.p->d->_inkSpanOps;
+
+	switch (ctx.p->ink) {
+	case kInkTypeAddPin:
+		ctx.proc32 = ops.addPin;
+		return byteChannels ? &inkSpanArithmetic32 : &inkSpanArithmetic<T, InkOpAddPin>;
+	case kInkTypeAdd:
+		ctx.proc32 = ops.add;
+		return byteChannels ? &inkSpanArithmetic32 : &inkSpanArithmetic<T, InkOpAdd>;
+	case kInkTypeSubPin:
+		ctx.proc32 = ops.subPin;
+		return byteChannels ? &inkSpanArithmetic32 : &inkSpanArithmetic<T, InkOpSubPin>;
+	case kInkTypeLight:
+		ctx.proc32 = ops.light;
+		return byteChannels ? &inkSpanArithmetic32 : &inkSpanArithmetic<T, InkOpLight>;
+	case kInkTypeSub:
+		ctx.proc32 = ops.sub;
+		return byteChannels ? &inkSpanArithmetic32 : &inkSpanArithmetic<T, InkOpSub>;
+	case kInkTypeDark:
+		ctx.proc32 = ops.dark;
+		return byteChannels ? &inkSpanArithmetic32 : &inkSpanArithmetic<T, InkOpDark>;
+	default:
+		return nullptr;
+	}
+}
+
+template <typename T>
+static InkSpanPtr getInkSpan(InkSpanContext &ctx) {
+	DirectorPlotData *p = ctx.p;
+	const Graphics::PixelFormat &pf = ctx.wm->_pixelformat;
+
+	// 32bpp formats with a whole byte per colour channel can be combined
+	// bytewise, without decomposing each pixel
+	bool byteChannels = sizeof(T) == 4 && pf.rBits() == 8 && pf.gBits() == 8 && pf.bBits() == 8 &&
+		(pf.rShift % 8) == 0 && (pf.gShift % 8) == 0 && (pf.bShift % 8) == 0;
+
+	// Leave text sprites whose colors preprocessColor() adjusts to the per-pixel path
+	if (p->sprite == kTextSprite) {
+		switch (p->ink) {
+		case kInkTypeMask:
+		case kInkTypeReverse:
+		case kInkTypeNotReverse:
+		case kInkTypeNotGhost:
+		case kInkTypeNotCopy:
+		case kInkTypeNotTrans:
+			return nullptr;
+		default:
+			break;
+		}
+	}
+
+	if (byteChannels) {
+		ctx.alphaFill = pf.RGBToColor(0, 0, 0);
+		ctx.rgbMask = pf.RGBToColor(0xff, 0xff, 0xff) ^ ctx.alphaFill;
+	}
+
+	if (p->alpha)
+		return byteChannels ? &inkSpanBlend32 : &inkSpanBlend<T>;
+
+	switch (p->ink) {
+	case kInkTypeBackgndTrans:
+		if (p->oneBitImage) {
+			ctx.key = p->colorBlack;
+			ctx.color = p->foreColor;
+			return &inkSpanKeyedFill<T>;
+		}
+		ctx.key = p->backColor;
+		return &inkSpanKeyedCopy<T>;
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeBlend:
+	case kInkTypeCopy:
+		if (!p->applyColor)
+			return &inkSpanCopy<T>;
+		return sizeof(T) == 1 ? &inkSpanColorize : nullptr;
+	case kInkTypeTransparent:
+		if (p->oneBitImage || p->applyColor) {
+			ctx.key = p->colorBlack;
+			ctx.color = p->foreColor;
+			return &inkSpanKeyedFill<T>;
+		}
+		return &inkSpanBitwise<T, InkOpOr>;
+	case kInkTypeNotTrans:
+		if (p->oneBitImage || p->applyColor) {
+			ctx.key = p->colorWhite;
+			ctx.color = p->foreColor;
+			return &inkSpanKeyedFill<T>;
+		}
+		return &inkSpanBitwise<T, InkOpOrNot>;
+	case kInkTypeReverse:
+		return &inkSpanBitwise<T, InkOpXor>;
+	case kInkTypeNotReverse:
+		return &inkSpanBitwise<T, InkOpXorNot>;
+	case kInkTypeGhost:
+		if (p->oneBitImage || p->applyColor) {
+			ctx.key = p->colorBlack;
+			ctx.color = p->backColor;
+			return &inkSpanKeyedFill<T>;
+		}
+		return &inkSpanBitwise<T, InkOpAndNot>;
+	case kInkTypeNotGhost:
+		if (p->oneBitImage || p->applyColor) {
+			ctx.key = p->colorWhite;
+			ctx.color = p->backColor;
+			return &inkSpanKeyedFill<T>;
+		}
+		return &inkSpanBitwise<T, InkOpAnd>;
+	default:
+		// NotCopy and anything unusual are left to inkDrawPixel()
+		return getArithmeticInkSpan<T>(ctx, byteChannels);
+	}
+}
+
 void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!srf)
 		return;
@@ -710,6 +952,54 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 	// format as the window manager. Most of the time this is
 	// the job of BitmapCastMember::createWidget.
 
+	// Draw whole runs at once when the ink has a span kernel and
+	// the source area needs no clipping
+	Common::Rect srcArea(
+		Common::Point(abs(srcRect.left - destRect.left), abs(srcRect.top - destRect.top)),
+		destRect.width(),
+		destRect.height()
+	);
+	InkSpanContext ctx;
+	InkSpanPtr span = nullptr;
+
+	if (!ms && srfClip.contains(srcArea)) {
+		ctx.p = this;
+		ctx.wm = d->_wm;
+		span = d->_wm->_pixelformat.bytesPerPixel == 1 ? getInkSpan<byte>(ctx) : getInkSpan<uint32>(ctx);
+	}
+
+	if (span) {
+		int bpp = d->_wm->_pixelformat.bytesPerPixel;
+		int width = destRect.width();
+
+		for (int i = 0; i < destRect.height(); i++) {
+			const byte *src = (const byte *)srf->getBasePtr(srcArea.left, srcArea.top + i);
+			byte *out = (byte *)dst->getBasePtr(destRect.left, destRect.top + i);
+
+			if (!mask) {
+				span(ctx, out, src, width);
+				continue;
+			}
+
+			const byte *msk = (const byte *)mask->getBasePtr(srcArea.left, srcArea.top + i);
+
+			for (int j = 0; j < width;) {
+				while (j < width && !msk[j])
+					j++;
+
+				int start = j;
+
+				while (j < width && msk[j])
+					j++;
+
+				if (j > start)
+					span(ctx, out + start * bpp, src + start * bpp, j - start);
+			}
+		}
+
+		return;
+	}
+
 	srcPoint.y = abs(srcRect.top - destRect.top);
 	for (int i = 0; i < destRect.height(); i++, srcPoint.y++) {
 		srcPoint.x = abs(srcRect.left - destRect.left);
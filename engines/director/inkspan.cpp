@@ -0,0 +1,81 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/system.h"
+#include "common/util.h"
+
+#include "director/inkspan.h"
+
+namespace Director {
+
+// Applies Op to every byte of the pixel; the bytes outside of rgbMask are
+// thrown away afterwards, so they may hold anything.
+template<class Op>
+static void inkSpanBytes32(uint32 *dst, const uint32 *src, int size, uint32 rgbMask, uint32 alphaFill) {
+	for (int i = 0; i < size; i++) {
+		uint32 s = src[i];
+		uint32 d = dst[i];
+		uint32 res = 0;
+
+		for (int shift = 0; shift < 32; shift += 8)
+			res |= (uint32)Op::apply((byte)(s >> shift), (byte)(d >> shift)) << shift;
+
+		dst[i] = (res & rgbMask) | alphaFill;
+	}
+}
+
+static void inkSpanBlend32(uint32 *dst, const uint32 *src, int size, int alpha, uint32 rgbMask, uint32 alphaFill) {
+	alpha = CLIP(alpha, 0, 255);
+
+	for (int i = 0; i < size; i++) {
+		uint32 s = src[i];
+		uint32 d = dst[i];
+		uint32 res = 0;
+
+		for (int shift = 0; shift < 32; shift += 8)
+			res |= (uint32)((((d >> shift) & 0xff) * alpha + ((s >> shift) & 0xff) * (255 - alpha)) / 255) << shift;
+
+		dst[i] = (res & rgbMask) | alphaFill;
+	}
+}
+
+void initInkSpanOps(InkSpanOps32 &ops) {
+	ops.blend = inkSpanBlend32;
+	ops.add = inkSpanBytes32<InkOpAdd>;
+	ops.addPin = inkSpanBytes32<InkOpAddPin>;
+	ops.sub = inkSpanBytes32<InkOpSub>;
+	ops.subPin = inkSpanBytes32<InkOpSubPin>;
+	ops.light = inkSpanBytes32<InkOpLight>;
+	ops.dark = inkSpanBytes32<InkOpDark>;
+
+#ifdef SCUMMVM_NEON
+	if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		initInkSpanOpsNEON(ops);
+#endif
+
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		initInkSpanOpsSSE2(ops);
+#endif
+}
+
+} // End of namespace Director
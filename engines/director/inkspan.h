@@ -0,0 +1,88 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DIRECTOR_INKSPAN_H
+#define DIRECTOR_INKSPAN_H
+
+#include "common/scummsys.h"
+#include "common/util.h"
+
+namespace Director {
+
+// Per-channel operations of the arithmetic inks, shared by the span
+// kernels of every bit depth.
+struct InkOpAdd {
+	static byte apply(byte s, byte d) { return (byte)(d + s); }
+};
+
+struct InkOpAddPin {
+	static byte apply(byte s, byte d) { return (byte)(d + MIN(0xff - d, (int)s)); }
+};
+
+struct InkOpSub {
+	static byte apply(byte s, byte d) { return (byte)(d - s); }
+};
+
+struct InkOpSubPin {
+	static byte apply(byte s, byte d) { return (byte)(MAX(d - s, 1) - 1); }
+};
+
+struct InkOpLight {
+	static byte apply(byte s, byte d) { return MAX(s, d); }
+};
+
+struct InkOpDark {
+	static byte apply(byte s, byte d) { return MIN(s, d); }
+};
+
+// Whole-run kernels for the arithmetic inks on 32bpp surfaces where red,
+// green and blue each take a full byte. Every colour byte selected by
+// rgbMask is combined on its own, the remaining bits are replaced with
+// alphaFill, so the result matches what findBestColor() would return.
+//
+// The table is filled with the portable implementations first, then the
+// entries are swapped for the vectorized ones the host CPU supports.
+typedef void (*InkSpan32Proc)(uint32 *dst, const uint32 *src, int size, uint32 rgbMask, uint32 alphaFill);
+
+struct InkSpanOps32 {
+	// dst = (dst * alpha + src * (255 - alpha)) / 255, like lerpByte()
+	void (*blend)(uint32 *dst, const uint32 *src, int size, int alpha, uint32 rgbMask, uint32 alphaFill);
+	InkSpan32Proc add;    // wrapping
+	InkSpan32Proc addPin; // saturating
+	InkSpan32Proc sub;    // wrapping
+	InkSpan32Proc subPin; // saturating, minus one, like inkDrawPixel()
+	InkSpan32Proc light;
+	InkSpan32Proc dark;
+};
+
+void initInkSpanOps(InkSpanOps32 &ops);
+
+#ifdef SCUMMVM_SSE2
+void initInkSpanOpsSSE2(InkSpanOps32 &ops);
+#endif
+
+#ifdef SCUMMVM_NEON
+void initInkSpanOpsNEON(InkSpanOps32 &ops);
+#endif
+
+} // End of namespace Director
+
+#endif
@@ -0,0 +1,165 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "common/util.h"
+
+#include "director/inkspan.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__)
+
+namespace Director {
+
+struct InkOpAddNEON {
+	typedef InkOpAdd Scalar;
+
+	static uint8x16_t apply(uint8x16_t s, uint8x16_t d) { return vaddq_u8(d, s); }
+};
+
+struct InkOpAddPinNEON {
+	typedef InkOpAddPin Scalar;
+
+	static uint8x16_t apply(uint8x16_t s, uint8x16_t d) { return vqaddq_u8(d, s); }
+};
+
+struct InkOpSubNEON {
+	typedef InkOpSub Scalar;
+
+	static uint8x16_t apply(uint8x16_t s, uint8x16_t d) { return vsubq_u8(d, s); }
+};
+
+struct InkOpSubPinNEON {
+	typedef InkOpSubPin Scalar;
+
+	static uint8x16_t apply(uint8x16_t s, uint8x16_t d) { return vqsubq_u8(vqsubq_u8(d, s), vdupq_n_u8(1)); }
+};
+
+struct InkOpLightNEON {
+	typedef InkOpLight Scalar;
+
+	static uint8x16_t apply(uint8x16_t s, uint8x16_t d) { return vmaxq_u8(s, d); }
+};
+
+struct InkOpDarkNEON {
+	typedef InkOpDark Scalar;
+
+	static uint8x16_t apply(uint8x16_t s, uint8x16_t d) { return vminq_u8(s, d); }
+};
+
+template<class Op>
+static void inkSpanBytes32NEON(uint32 *dst, const uint32 *src, int size, uint32 rgbMask, uint32 alphaFill) {
+	const uint8x16_t mask = vreinterpretq_u8_u32(vdupq_n_u32(rgbMask));
+	const uint8x16_t fill = vreinterpretq_u8_u32(vdupq_n_u32(alphaFill));
+
+	for (; size >= 4; size -= 4, src += 4, dst += 4) {
+		uint8x16_t s = vld1q_u8((const uint8 *)src);
+		uint8x16_t d = vld1q_u8((const uint8 *)dst);
+		vst1q_u8((uint8 *)dst, vorrq_u8(vandq_u8(Op::apply(s, d), mask), fill));
+	}
+
+	while (size-- > 0) {
+		uint32 s = *src++;
+		uint32 d = *dst;
+		uint32 res = 0;
+
+		for (int shift = 0; shift < 32; shift += 8)
+			res |= (uint32)Op::Scalar::apply((byte)(s >> shift), (byte)(d >> shift)) << shift;
+
+		*dst++ = (res & rgbMask) | alphaFill;
+	}
+}
+
+// Computes (d * alpha + s * (255 - alpha)) / 255 on eight lanes.
+// The division is exact for every value the sum can take.
+static FORCEINLINE uint8x8_t lerpLanes(uint8x8_t s, uint8x8_t d, uint8x8_t alpha, uint8x8_t invAlpha) {
+	uint16x8_t x = vmlal_u8(vmull_u8(d, alpha), s, invAlpha);
+	x = vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8));
+	return vshrn_n_u16(x, 8);
+}
+
+static void inkSpanBlend32NEON(uint32 *dst, const uint32 *src, int size, int alpha, uint32 rgbMask, uint32 alphaFill) {
+	alpha = CLIP(alpha, 0, 255);
+
+	const uint8x8_t a = vdup_n_u8((uint8)alpha);
+	const uint8x8_t invA = vdup_n_u8((uint8)(255 - alpha));
+	const uint8x16_t mask = vreinterpretq_u8_u32(vdupq_n_u32(rgbMask));
+	const uint8x16_t fill = vreinterpretq_u8_u32(vdupq_n_u32(alphaFill));
+
+	for (; size >= 4; size -= 4, src += 4, dst += 4) {
+		uint8x16_t s = vld1q_u8((const uint8 *)src);
+		uint8x16_t d = vld1q_u8((const uint8 *)dst);
+
+		uint8x8_t lo = lerpLanes(vget_low_u8(s), vget_low_u8(d), a, invA);
+		uint8x8_t hi = lerpLanes(vget_high_u8(s), vget_high_u8(d), a, invA);
+
+		vst1q_u8((uint8 *)dst, vorrq_u8(vandq_u8(vcombine_u8(lo, hi), mask), fill));
+	}
+
+	while (size-- > 0) {
+		uint32 s = *src++;
+		uint32 d = *dst;
+		uint32 res = 0;
+
+		for (int shift = 0; shift < 32; shift += 8)
+			res |= (uint32)((((d >> shift) & 0xff) * alpha + ((s >> shift) & 0xff) * (255 - alpha)) / 255) << shift;
+
+		*dst++ = (res & rgbMask) | alphaFill;
+	}
+}
+
+void initInkSpanOpsNEON(InkSpanOps32 &ops) {
+	ops.blend = inkSpanBlend32NEON;
+	ops.add = inkSpanBytes32NEON<InkOpAddNEON>;
+	ops.addPin = inkSpanBytes32NEON<InkOpAddPinNEON>;
+	ops.sub = inkSpanBytes32NEON<InkOpSubNEON>;
+	ops.subPin = inkSpanBytes32NEON<InkOpSubPinNEON>;
+	ops.light = inkSpanBytes32NEON<InkOpLightNEON>;
+	ops.dark = inkSpanBytes32NEON<InkOpDarkNEON>;
+}
+
+} // End of namespace Director
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__)
+
+#endif // SCUMMVM_NEON
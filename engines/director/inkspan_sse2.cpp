@@ -0,0 +1,166 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "common/util.h"
+
+#include "director/inkspan.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Director {
+
+struct InkOpAddSSE2 {
+	typedef InkOpAdd Scalar;
+
+	static __m128i apply(__m128i s, __m128i d) { return _mm_add_epi8(d, s); }
+};
+
+struct InkOpAddPinSSE2 {
+	typedef InkOpAddPin Scalar;
+
+	static __m128i apply(__m128i s, __m128i d) { return _mm_adds_epu8(d, s); }
+};
+
+struct InkOpSubSSE2 {
+	typedef InkOpSub Scalar;
+
+	static __m128i apply(__m128i s, __m128i d) { return _mm_sub_epi8(d, s); }
+};
+
+struct InkOpSubPinSSE2 {
+	typedef InkOpSubPin Scalar;
+
+	static __m128i apply(__m128i s, __m128i d) { return _mm_subs_epu8(_mm_subs_epu8(d, s), _mm_set1_epi8(1)); }
+};
+
+struct InkOpLightSSE2 {
+	typedef InkOpLight Scalar;
+
+	static __m128i apply(__m128i s, __m128i d) { return _mm_max_epu8(s, d); }
+};
+
+struct InkOpDarkSSE2 {
+	typedef InkOpDark Scalar;
+
+	static __m128i apply(__m128i s, __m128i d) { return _mm_min_epu8(s, d); }
+};
+
+template<class Op>
+static void inkSpanBytes32SSE2(uint32 *dst, const uint32 *src, int size, uint32 rgbMask, uint32 alphaFill) {
+	const __m128i mask = _mm_set1_epi32((int)rgbMask);
+	const __m128i fill = _mm_set1_epi32((int)alphaFill);
+
+	for (; size >= 4; size -= 4, src += 4, dst += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i d = _mm_loadu_si128((const __m128i *)dst);
+		_mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_and_si128(Op::apply(s, d), mask), fill));
+	}
+
+	while (size-- > 0) {
+		uint32 s = *src++;
+		uint32 d = *dst;
+		uint32 res = 0;
+
+		for (int shift = 0; shift < 32; shift += 8)
+			res |= (uint32)Op::Scalar::apply((byte)(s >> shift), (byte)(d >> shift)) << shift;
+
+		*dst++ = (res & rgbMask) | alphaFill;
+	}
+}
+
+// Computes (d * alpha + s * (255 - alpha)) / 255 on eight 16-bit lanes.
+// The division is exact for every value the sum can take.
+static FORCEINLINE __m128i lerpLanes(__m128i s, __m128i d, __m128i alpha, __m128i invAlpha) {
+	__m128i x = _mm_add_epi16(_mm_mullo_epi16(d, alpha), _mm_mullo_epi16(s, invAlpha));
+	x = _mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8));
+	return _mm_srli_epi16(x, 8);
+}
+
+static void inkSpanBlend32SSE2(uint32 *dst, const uint32 *src, int size, int alpha, uint32 rgbMask, uint32 alphaFill) {
+	alpha = CLIP(alpha, 0, 255);
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i a = _mm_set1_epi16((short)alpha);
+	const __m128i invA = _mm_set1_epi16((short)(255 - alpha));
+	const __m128i mask = _mm_set1_epi32((int)rgbMask);
+	const __m128i fill = _mm_set1_epi32((int)alphaFill);
+
+	for (; size >= 4; size -= 4, src += 4, dst += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i d = _mm_loadu_si128((const __m128i *)dst);
+
+		__m128i lo = lerpLanes(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), a, invA);
+		__m128i hi = lerpLanes(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), a, invA);
+
+		_mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_and_si128(_mm_packus_epi16(lo, hi), mask), fill));
+	}
+
+	while (size-- > 0) {
+		uint32 s = *src++;
+		uint32 d = *dst;
+		uint32 res = 0;
+
+		for (int shift = 0; shift < 32; shift += 8)
+			res |= (uint32)((((d >> shift) & 0xff) * alpha + ((s >> shift) & 0xff) * (255 - alpha)) / 255) << shift;
+
+		*dst++ = (res & rgbMask) | alphaFill;
+	}
+}
+
+void initInkSpanOpsSSE2(InkSpanOps32 &ops) {
+	ops.blend = inkSpanBlend32SSE2;
+	ops.add = inkSpanBytes32SSE2<InkOpAddSSE2>;
+	ops.addPin = inkSpanBytes32SSE2<InkOpAddPinSSE2>;
+	ops.sub = inkSpanBytes32SSE2<InkOpSubSSE2>;
+	ops.subPin = inkSpanBytes32SSE2<InkOpSubPinSSE2>;
+	ops.light = inkSpanBytes32SSE2<InkOpLightSSE2>;
+	ops.dark = inkSpanBytes32SSE2<InkOpDarkSSE2>;
+}
+
+} // End of namespace Director
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
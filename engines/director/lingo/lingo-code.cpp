@@ -185,7 +185,7 @@ void Lingo::cleanupFuncs() {
 }
 
 void Lingo::push(Datum d) {
-	_stack.push_back(d);
+	_stack.push_back(Common::move(d));
 }
 
 Datum Lingo::getVoid() {
@@ -196,14 +196,13 @@ Datum Lingo::getVoid() {
 }
 
 void Lingo::pushVoid() {
-	Datum d = getVoid();
-	push(d);
+	_stack.push_back(Datum());
 }
 
 Datum Lingo::pop() {
 	assert (_stack.size() != 0);
 
-	Datum ret = _stack.back();
+	Datum ret = Common::move(_stack.back());
 	_stack.pop_back();
 
 	return ret;
@@ -861,29 +861,64 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool equality) {
 	return opType;
 }
 
+uint32 Datum::allocations = 0;
+
+// Datums start out as the only owner of their payload, with no reference
+// counter at all. The counter is only allocated once a Datum holding a
+// payload gets copied, so scalars never need one.
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Datum &d) {
+	type = d.type;
+	u = d.u;
+	refCount = d.shareRefCount();
+	ignoreGlobal = false;
+}
+
+Datum::Datum(Datum &&d) {
 	type = d.type;
 	u = d.u;
 	refCount = d.refCount;
-	*refCount += 1;
 	ignoreGlobal = false;
+
+	d.type = VOID;
+	d.refCount = nullptr;
 }
 
 Datum& Datum::operator=(const Datum &d) {
-	if (this != &d && refCount != d.refCount) {
+	if (this != &d && (!refCount || refCount != d.refCount)) {
+		// Take the new reference first, d may live inside our own payload
+		int *newRefCount = d.shareRefCount();
+		DatumType newType = d.type;
+		auto newU = d.u;
+
 		reset();
-		type = d.type;
-		u = d.u;
-		refCount = d.refCount;
-		*refCount += 1;
+		type = newType;
+		u = newU;
+		refCount = newRefCount;
+	}
+	ignoreGlobal = false;
+	return *this;
+}
+
+Datum& Datum::operator=(Datum &&d) {
+	if (this != &d) {
+		DatumType newType = d.type;
+		auto newU = d.u;
+		int *newRefCount = d.refCount;
+
+		d.type = VOID;
+		d.refCount = nullptr;
+
+		reset();
+		type = newType;
+		u = newU;
+		refCount = newRefCount;
 	}
 	ignoreGlobal = false;
 	return *this;
@@ -892,24 +927,22 @@ Datum& Datum::operator=(const Datum &d) {
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Common::String &val) {
 	u.s = new Common::String(val);
+	allocations++;
 	type = STRING;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
@@ -921,52 +954,80 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const CastMemberID &val) {
 	u.cast = new CastMemberID(val);
+	allocations++;
 	type = CASTREF;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Common::Point &point) {
 	type = POINT;
 	u.farr = new FArray;
+	allocations++;
 	u.farr->arr.push_back(Datum(point.x));
 	u.farr->arr.push_back(Datum(point.y));
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Common::Rect &rect) {
 	type = RECT;
 	u.farr = new FArray;
+	allocations++;
 	u.farr->arr.push_back(Datum(rect.left));
 	u.farr->arr.push_back(Datum(rect.top));
 	u.farr->arr.push_back(Datum(rect.right));
 	u.farr->arr.push_back(Datum(rect.bottom));
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
+bool Datum::hasPayload() const {
+	switch (type) {
+	case VOID:
+	case INT:
+	case FLOAT:
+	case ARGC:
+	case ARGCNORET:
+		return false;
+	default:
+		return true;
+	}
+}
+
+int *Datum::shareRefCount() const {
+	if (!refCount) {
+		if (!hasPayload())
+			return nullptr;
+
+		refCount = new int;
+		*refCount = 1;
+		allocations++;
+	}
+
+	*refCount += 1;
+	return refCount;
+}
+
 void Datum::reset() {
-	if (!refCount)
+	if (refCount) {
+		*refCount -= 1;
+	} else if (!hasPayload()) {
 		return;
+	}
 
-	*refCount -= 1;
 	// Coverity thinks that we always free memory, as it assumes
 	// (correctly) that there are cases when refCount == 0
 	// Thus, DO NOT COMPILE, trick it and shut tons of false positives
 #ifndef __COVERITY__
-	if (*refCount <= 0) {
+	if (!refCount || *refCount <= 0) {
 		switch (type) {
 		case VOID:
 		case INT:
@@ -993,7 +1054,8 @@ void Datum::reset() {
 		case OBJECT:
 			if (u.obj->getObjType() == kWindowObj) {
 				// Window has an override for decRefCount, use it directly
-				*refCount += 1;
+				if (refCount)
+					*refCount += 1;
 				static_cast<Window *>(u.obj)->decRefCount();
 			} else {
 				// *refCount is copied between the Datum and the Object,
@@ -1018,10 +1080,12 @@ void Datum::reset() {
 			warning("Datum::reset(): Unprocessed REF type %d", type);
 			break;
 		}
-		if (type != OBJECT) // object owns refCount
+		if (refCount && type != OBJECT) // object owns refCount
 			delete refCount;
 	}
 #endif
+	refCount = nullptr;
+	type = VOID;
 }
 
 Datum Datum::eval() const {
@@ -1488,10 +1552,12 @@ void Lingo::runTests() {
 			mainArchive->addCode(Common::U32String(script, Common::kMacRoman), kTestScript, counter);
 
 			if (!debugChannelSet(-1, kDebugCompileOnly)) {
-				if (!_compiler->_hadError)
-					executeScript(kTestScript, CastMemberID(counter, DEFAULT_CAST_LIB));
-				else
+				if (_compiler->_hadError)
 					debug(">> Skipping execution");
+				else if (debugChannelSet(-1, kDebugLingoBench))
+					benchmarkScript(kTestScript, CastMemberID(counter, DEFAULT_CAST_LIB), fileList[i]);
+				else
+					executeScript(kTestScript, CastMemberID(counter, DEFAULT_CAST_LIB));
 			}
 
 			free(script);
@@ -1503,6 +1569,28 @@ void Lingo::runTests() {
 	}
 }
 
+// Runs a test script a few times over, reporting how many payloads the Datum
+// constructors and how many reference counters the Datum copies allocate per
+// executed opcode. Payloads built directly into a Datum's union, as most
+// builtins do, are not counted.
+void Lingo::benchmarkScript(ScriptType type, CastMemberID id, const Common::Path &path) {
+	const int runs = 10;
+
+	uint startCounter = _globalCounter;
+	uint32 startAllocations = Datum::allocations;
+	uint32 startTime = g_system->getMillis();
+
+	for (int i = 0; i < runs; i++)
+		executeScript(type, id);
+
+	uint opcodes = _globalCounter - startCounter;
+	uint32 allocations = Datum::allocations - startAllocations;
+
+	debug(">> Benchmark %s: %d runs, %d opcodes, %d Datum constructor/copy allocations, %.3f per opcode, %d ms",
+		path.toString(g_director->_dirSeparator).c_str(), runs, opcodes, allocations,
+		opcodes ? (double)allocations / opcodes : 0.0, g_system->getMillis() - startTime);
+}
+
 void Lingo::executeImmediateScripts(Frame *frame) {
 	for (uint16 i = 0; i <= _vm->getCurrentMovie()->getScore()->_numChannelsDisplayed; i++) {
 		if (_vm->getCurrentMovie()->getScore()->_immediateActions.contains(frame->_sprites[i]->_scriptId.member)) {
@@ -143,13 +143,19 @@ struct Datum {	/* interpreter stack type */
 		PictureReference *picture; /* PICTUREREF */
 	} u;
 
-	int *refCount;
+	// Shared between the copies of a Datum, allocated on the first copy.
+	// A Datum without one is the only owner of its payload.
+	mutable int *refCount;
 
 	bool ignoreGlobal; // True if this Datum should be ignored by showGlobals and clearGlobals
 
+	static uint32 allocations; // Payloads allocated by the constructors and counters allocated by copies, for benchmarking
+
 	Datum();
 	Datum(const Datum &d);
+	Datum(Datum &&d);
 	Datum& operator=(const Datum &d);
+	Datum& operator=(Datum &&d);
 	Datum(int val);
 	Datum(double val);
 	Datum(const Common::String &val);
@@ -175,6 +181,7 @@ struct Datum {	/* interpreter stack type */
 	bool isCastRef() const;
 	bool isArray() const;
 	bool isNumeric() const;
+	bool hasPayload() const;
 
 	const char *type2str(bool ilk = false) const;
 
@@ -186,6 +193,9 @@ struct Datum {	/* interpreter stack type */
 	bool operator<(Datum &d) const;
 	bool operator>=(Datum &d) const;
 	bool operator<=(Datum &d) const;
+
+private:
+	int *shareRefCount() const;
 };
 
 struct ChunkReference {
@@ -392,6 +402,7 @@ public:
 	void reloadOpenXLibs();
 
 	void runTests();
+	void benchmarkScript(ScriptType type, CastMemberID id, const Common::Path &path);
 
 	// lingo-events.cpp
 private:
@@ -13,6 +13,7 @@ MODULE_OBJS = \
 	game-quirks.o \
 	graphics.o \
 	images.o \
+	inkspan.o \
 	metaengine.o \
 	movie.o \
 	picture.o \
@@ -169,6 +170,15 @@ MODULE_OBJS = \
 	lingo/xtras/scrnutil.o \
 	lingo/xtras/timextra.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	inkspan_neon.o
+endif
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	inkspan_sse2.o
+endif
 
 ifdef USE_IMGUI
 MODULE_OBJS += \
@@ -801,6 +801,8 @@ void Score::updateSprites(RenderMode mode) {
 		}
 
 		if (channel->isDirty(nextSprite) || widgetRedrawn || mode == kRenderForceUpdate) {
+			_window->markChannelChanged(i);
+
 			bool invalidCastMember = currentSprite && currentSprite->_spriteType == kCastMemberSprite && currentSprite->_cast == nullptr;
 			if (currentSprite && !invalidCastMember && !currentSprite->_trails)
 				_window->addDirtyRect(channel->getBbox());
@@ -1300,6 +1302,7 @@ void Score::updateWidgets(bool hasVideoPlayback) {
 			channel->updateVideoTime();
 		if (cast && (cast->_type != kCastDigitalVideo || hasVideoPlayback) && cast->isModified()) {
 			channel->replaceWidget();
+			_window->markChannelChanged(i);
 			_window->addDirtyRect(channel->getBbox());
 		}
 	}
@@ -1309,6 +1312,7 @@ void Score::invalidateRectsForMember(CastMember *member) {
 	for (uint16 i = 0; i < _channels.size(); i++) {
 		Channel *channel = _channels[i];
 		if (channel->_sprite->_cast == member) {
+			_window->markChannelChanged(i);
 			_window->addDirtyRect(channel->getBbox());
 		}
 	}
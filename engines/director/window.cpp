@@ -62,6 +62,12 @@ Window::Window(int id, bool scrollable, bool resizable, bool editable, Graphics:
 	_windowType = -1;
 	_isModal = false;
 
+	_layerSurface = nullptr;
+	_renderCount = 0;
+	_layerHits = 0;
+	_layerMisses = 0;
+	_layerRebuilds = 0;
+
 	updateBorderType();
 
 	_draggable = !_isStage;
@@ -77,6 +83,10 @@ Window::~Window() {
 		delete _frozenLingoStates[i];
 	if (_puppetTransition)
 		delete _puppetTransition;
+	if (_layerSurface) {
+		_layerSurface->free();
+		delete _layerSurface;
+	}
 }
 
 void Window::decRefCount() {
@@ -145,6 +155,7 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	if (forceRedraw) {
 		blitTo->clear(_stageColor);
 		markAllDirty();
+		invalidateLayerCache();
 	} else {
 		if (_dirtyRects.size() == 0 && _currentMovie->_videoPlayback == false) {
 			if (g_director->_debugDraw & kDebugDrawFrame) {
@@ -164,6 +175,13 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	uint32 renderStartTime = g_system->getMillis();
 	debugC(7, kDebugImages, "Window::render(): Updating %d rects", _dirtyRects.size());
 
+	_renderCount++;
+	updateLayerCache(hiliteChannel, blitTo);
+
+	const Common::Array<Channel *> &channels = _currentMovie->getScore()->_channels;
+	bool useLayer = !_layerChannels.empty() && _layerSurface->w == blitTo->w && _layerSurface->h == blitTo->h;
+	uint32 layerHits = 0;
+
 	for (auto &i : _dirtyRects) {
 		const Common::Rect &r = i;
 		_dirtyChannels = _currentMovie->getScore()->getSpriteIntersections(r);
@@ -176,11 +194,32 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 			}
 		}
 
-		if (shouldClear)
+		// The cached layer already holds the stage color and the lowest
+		// channels, so only the channels above it are drawn over it
+		uint layerSize = 0;
+
+		Common::Rect layerRect = r;
+		layerRect.clip(Common::Rect(blitTo->w, blitTo->h));
+
+		if (shouldClear && useLayer) {
+			blitTo->blitFrom(*_layerSurface, layerRect, Common::Point(layerRect.left, layerRect.top));
+			layerSize = _layerChannels.size();
+			layerHits++;
+		} else if (shouldClear) {
 			blitTo->fillRect(r, _stageColor);
+		}
 
 		for (int pass = 0; pass < 2; pass++) {
+			uint layerPos = 0;
+
 			for (auto &j : _dirtyChannels) {
+				// Intersections come in channel order, skip those baked into the layer
+				while (layerPos < layerSize && channels[layerPos] != j)
+					layerPos++;
+
+				if (layerPos < layerSize)
+					continue;
+
 				if (j->isActiveVideo() && j->isVideoDirectToStage()) {
 					if (pass == 0)
 						continue;
@@ -223,9 +262,14 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	if (g_director->_debugDraw & kDebugDrawFrame)
 		drawFrameCounter(blitTo);
 
+	_layerHits += layerHits;
+	_layerMisses += _dirtyRects.size() - layerHits;
+
 	_dirtyRects.clear();
 	_contentIsDirty = true;
-	debugC(7, kDebugImages, "Window::render(): Draw finished in %d ms",  g_system->getMillis() - renderStartTime);
+	debugC(7, kDebugImages, "Window::render(): Draw finished in %d ms, layer cache: %d channels, %d hits this frame, %d%% hit rate, %d rebuilds",
+		g_system->getMillis() - renderStartTime, _layerChannels.size(), layerHits,
+		_layerHits + _layerMisses ? _layerHits * 100 / (_layerHits + _layerMisses) : 0, _layerRebuilds);
 
 	return true;
 }
@@ -238,6 +282,124 @@ void Window::setStageColor(uint32 stageColor, bool forceReset) {
 	}
 }
 
+void Window::markChannelChanged(uint16 channelId) {
+	if (channelId >= _channelChangedAt.size())
+		_channelChangedAt.resize(channelId + 1);
+
+	_channelChangedAt[channelId] = _renderCount;
+
+	if (channelId < _layerChannels.size())
+		invalidateLayerCache();
+}
+
+void Window::invalidateLayerCache() {
+	_layerChannels.clear();
+}
+
+// Number of renders a channel has to stay unchanged before it is
+// flattened into the layer, so that sprites which move every few
+// frames do not cause a rebuild each time
+#define LAYER_SETTLE_RENDERS 4
+
+bool Window::isLayerCacheable(uint16 channelId, Channel *hiliteChannel) {
+	Channel *channel = _currentMovie->getScore()->_channels[channelId];
+
+	if (channelId < _channelChangedAt.size() && _renderCount - _channelChangedAt[channelId] < LAYER_SETTLE_RENDERS)
+		return false;
+
+	if (channel->isEmpty() || !channel->_visible)
+		return true;
+
+	// Anything that changes without going through the channel dirty
+	// flags, or is drawn out of channel order, stays out of the layer
+	return channel != hiliteChannel && !channel->isTrail() && !channel->isActiveVideo() &&
+		!channel->hasSubChannels() && !channel->getEditable();
+}
+
+bool Window::isLayerCacheValid(Channel *hiliteChannel) {
+	const Common::Array<Channel *> &channels = _currentMovie->getScore()->_channels;
+
+	if (_layerChannels.size() > channels.size())
+		return false;
+
+	for (uint i = 0; i < _layerChannels.size(); i++) {
+		const LayerChannelState &state = _layerChannels[i];
+		Channel *channel = channels[i];
+
+		if (state.channel != channel || channel == hiliteChannel || state.widget != channel->_widget ||
+				state.visible != channel->_visible || state.bbox != channel->getBbox() ||
+				state.castId != channel->_sprite->_castId || state.ink != channel->_sprite->_ink ||
+				state.blend != channel->_sprite->_blend || state.foreColor != channel->_sprite->_foreColor ||
+				state.backColor != channel->_sprite->_backColor)
+			return false;
+	}
+
+	return true;
+}
+
+void Window::updateLayerCache(Channel *hiliteChannel, Graphics::ManagedSurface *blitTo) {
+	const Common::Array<Channel *> &channels = _currentMovie->getScore()->_channels;
+
+	if (!isLayerCacheValid(hiliteChannel))
+		invalidateLayerCache();
+
+	if (blitTo != _composeSurface)
+		return;
+
+	// Grow the layer once the channel right above it has settled too
+	if (!_layerChannels.empty()) {
+		if (_layerChannels.size() == channels.size() || !isLayerCacheable(_layerChannels.size(), hiliteChannel))
+			return;
+
+		invalidateLayerCache();
+	}
+
+	uint layerSize = 0;
+
+	while (layerSize < channels.size() && isLayerCacheable(layerSize, hiliteChannel))
+		layerSize++;
+
+	// Only worth it if at least one channel is actually drawn into it
+	bool hasContent = false;
+
+	for (uint i = 0; i < layerSize && !hasContent; i++)
+		hasContent = !channels[i]->isEmpty() && channels[i]->_visible;
+
+	if (!hasContent)
+		return;
+
+	if (!_layerSurface)
+		_layerSurface = new Graphics::ManagedSurface();
+
+	if (_layerSurface->w != blitTo->w || _layerSurface->h != blitTo->h || _layerSurface->format != blitTo->format)
+		_layerSurface->create(blitTo->w, blitTo->h, blitTo->format);
+
+	Common::Rect bounds(_layerSurface->w, _layerSurface->h);
+	_layerSurface->fillRect(bounds, _stageColor);
+
+	for (uint i = 0; i < layerSize; i++) {
+		Channel *channel = channels[i];
+		LayerChannelState state;
+
+		state.channel = channel;
+		state.widget = channel->_widget;
+		state.bbox = channel->getBbox();
+		state.visible = channel->_visible;
+		state.castId = channel->_sprite->_castId;
+		state.ink = channel->_sprite->_ink;
+		state.blend = channel->_sprite->_blend;
+		state.foreColor = channel->_sprite->_foreColor;
+		state.backColor = channel->_sprite->_backColor;
+		_layerChannels.push_back(state);
+
+		if (!channel->isEmpty() && channel->_visible)
+			inkBlitFrom(channel, bounds, _layerSurface);
+	}
+
+	_layerRebuilds++;
+	debugC(7, kDebugImages, "Window::updateLayerCache(): Flattened %d channels", layerSize);
+}
+
 void Window::setTitleVisible(bool titleVisible) {
 	MacWindow::setTitleVisible(titleVisible);
 	updateBorderType();
@@ -290,6 +452,7 @@ void Window::setFileName(Common::String filename) {
 void Window::reset() {
 	resizeInner(_composeSurface->w, _composeSurface->h);
 	_contentIsDirty = true;
+	invalidateLayerCache();
 }
 
 void Window::inkBlitFrom(Channel *channel, Common::Rect destRect, Graphics::ManagedSurface *blitTo) {
@@ -30,6 +30,7 @@ class Error;
 
 namespace Graphics {
 class ManagedSurface;
+class MacWidget;
 class MacWindow;
 class MacWindowManager;
 }
@@ -115,6 +116,9 @@ public:
 
 	void reset();
 
+	void markChannelChanged(uint16 channelId);
+	void invalidateLayerCache();
+
 	// transitions.cpp
 	void exitTransition(TransParams &t, Graphics::ManagedSurface *nextFrame, Common::Rect clipRect);
 	void stepTransition(TransParams &t, int step);
@@ -221,10 +225,37 @@ private:
 	int _windowType;
 	bool _isModal;
 
+	// Retained composite of the stage and the lowest channels that have
+	// not changed for a while. Dirty rects are restored from it, so only
+	// the channels above it need to be drawn again.
+	struct LayerChannelState {
+		Channel *channel;
+		Graphics::MacWidget *widget;
+		Common::Rect bbox;
+		bool visible;
+		CastMemberID castId;
+		InkType ink;
+		byte blend;
+		uint32 foreColor;
+		uint32 backColor;
+	};
+
+	Graphics::ManagedSurface *_layerSurface;
+	Common::Array<LayerChannelState> _layerChannels;
+	Common::Array<uint32> _channelChangedAt;
+	uint32 _renderCount;
+	uint32 _layerHits;
+	uint32 _layerMisses;
+	uint32 _layerRebuilds;
+
 private:
 	void inkBlitFrom(Channel *channel, Common::Rect destRect, Graphics::ManagedSurface *blitTo = nullptr);
 	void drawFrameCounter(Graphics::ManagedSurface *blitTo);
 
+	bool isLayerCacheable(uint16 channelId, Channel *hiliteChannel);
+	bool isLayerCacheValid(Channel *hiliteChannel);
+	void updateLayerCache(Channel *hiliteChannel, Graphics::ManagedSurface *blitTo);
+
 
 };
 
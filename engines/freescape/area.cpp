@@ -96,6 +96,15 @@ Area::Area(uint16 areaID_, uint16 areaFlags_, ObjectMap *objectsByID_, ObjectMap
 
 	Common::sort(_drawableObjects.begin(), _drawableObjects.end(), compareObjects);
 	_lastTick = 0;
+
+	_gridValid = false;
+	_gridGeneration = 0;
+	_gridCellSize = 1.0;
+	_gridOriginX = 0;
+	_gridOriginZ = 0;
+	_gridWidth = 0;
+	_gridHeight = 0;
+	_gridMark = 0;
 }
 
 Area::~Area() {
@@ -379,12 +388,153 @@ bool Area::hasActiveGroups() {
 	return false;
 }
 
+// Upper bound of grid cells per axis, and of the cells an object may span
+// per axis before it is kept out of the grid and tested by every query.
+static const int kCollisionGridMaxCells = 64;
+static const int kCollisionGridMaxSpan = 16;
+// Slack added around a query region, so that sweeps ending right at the
+// face of an object still find it.
+static const float kCollisionGridMargin = 2.0;
+
+static bool collisionGridRange(float min, float max, float origin, float cellSize, int cells, int &first, int &last) {
+	float firstCell = floorf((min - origin) / cellSize);
+	float lastCell = floorf((max - origin) / cellSize);
+	if (lastCell < 0 || firstCell >= cells)
+		return false;
+
+	first = firstCell < 0 ? 0 : (int)firstCell;
+	last = lastCell >= cells ? cells - 1 : (int)lastCell;
+	return true;
+}
+
+void Area::updateCollisionGrid() {
+	if (_gridValid && _gridGeneration == GeometricObject::_boundingBoxGeneration)
+		return;
+
+	_gridValid = true;
+	_gridGeneration = GeometricObject::_boundingBoxGeneration;
+	_gridOverflow.clear();
+	_gridMarks.resize(_drawableObjects.size());
+	for (uint i = 0; i < _gridMarks.size(); i++)
+		_gridMarks[i] = 0;
+	_gridMark = 0;
+
+	// The cell size follows the median footprint, which the floor and the
+	// other huge objects cannot skew
+	Common::Array<float> footprints;
+	for (auto &obj : _drawableObjects) {
+		if (obj->_boundingBox.isValid()) {
+			Math::Vector3d size = obj->_boundingBox.getSize();
+			footprints.push_back(MAX(size.x(), size.z()));
+		}
+	}
+
+	_gridWidth = 0;
+	_gridHeight = 0;
+	if (footprints.empty()) {
+		for (uint i = 0; i < _drawableObjects.size(); i++)
+			_gridOverflow.push_back(i);
+		return;
+	}
+
+	Common::sort(footprints.begin(), footprints.end());
+	_gridCellSize = MAX(2 * footprints[footprints.size() / 2], 1.0f);
+	float maxFootprint = kCollisionGridMaxSpan * _gridCellSize;
+
+	Math::AABB extent;
+	for (uint i = 0; i < _drawableObjects.size(); i++) {
+		const Math::AABB &box = _drawableObjects[i]->_boundingBox;
+		if (!box.isValid() || box.getSize().x() > maxFootprint || box.getSize().z() > maxFootprint) {
+			_gridOverflow.push_back(i);
+			continue;
+		}
+		extent.expand(box.getMin());
+		extent.expand(box.getMax());
+	}
+
+	if (!extent.isValid())
+		return;
+
+	Math::Vector3d extentSize = extent.getSize();
+	_gridCellSize = MAX(_gridCellSize, MAX(extentSize.x(), extentSize.z()) / (kCollisionGridMaxCells - 1));
+	_gridOriginX = extent.getMin().x();
+	_gridOriginZ = extent.getMin().z();
+	_gridWidth = MIN((int)(extentSize.x() / _gridCellSize) + 1, kCollisionGridMaxCells);
+	_gridHeight = MIN((int)(extentSize.z() / _gridCellSize) + 1, kCollisionGridMaxCells);
+
+	_gridCells.resize(_gridWidth * _gridHeight);
+	for (auto &cell : _gridCells)
+		cell.clear();
+
+	uint overflow = 0;
+	for (uint i = 0; i < _drawableObjects.size(); i++) {
+		if (overflow < _gridOverflow.size() && _gridOverflow[overflow] == i) {
+			overflow++;
+			continue;
+		}
+
+		const Math::AABB &box = _drawableObjects[i]->_boundingBox;
+		int x0, x1, z0, z1;
+		if (!collisionGridRange(box.getMin().x(), box.getMax().x(), _gridOriginX, _gridCellSize, _gridWidth, x0, x1) ||
+			!collisionGridRange(box.getMin().z(), box.getMax().z(), _gridOriginZ, _gridCellSize, _gridHeight, z0, z1))
+			continue;
+
+		for (int z = z0; z <= z1; z++)
+			for (int x = x0; x <= x1; x++)
+				_gridCells[z * _gridWidth + x].push_back(i);
+	}
+}
+
+// Collects the indices of the objects whose box may touch the region, in
+// the same order as _drawableObjects so the queries keep resolving ties
+// exactly like a full scan does.
+void Area::gatherCollisionCandidates(const Math::AABB &region, Common::Array<uint16> &candidates) {
+	updateCollisionGrid();
+	candidates.clear();
+
+	if (++_gridMark == 0) {
+		for (uint i = 0; i < _gridMarks.size(); i++)
+			_gridMarks[i] = 0;
+		_gridMark = 1;
+	}
+
+	for (auto &index : _gridOverflow) {
+		_gridMarks[index] = _gridMark;
+		candidates.push_back(index);
+	}
+
+	int x0, x1, z0, z1;
+	if (region.isValid() &&
+		collisionGridRange(region.getMin().x() - kCollisionGridMargin, region.getMax().x() + kCollisionGridMargin, _gridOriginX, _gridCellSize, _gridWidth, x0, x1) &&
+		collisionGridRange(region.getMin().z() - kCollisionGridMargin, region.getMax().z() + kCollisionGridMargin, _gridOriginZ, _gridCellSize, _gridHeight, z0, z1)) {
+		for (int z = z0; z <= z1; z++) {
+			for (int x = x0; x <= x1; x++) {
+				for (auto &index : _gridCells[z * _gridWidth + x]) {
+					if (_gridMarks[index] != _gridMark) {
+						_gridMarks[index] = _gridMark;
+						candidates.push_back(index);
+					}
+				}
+			}
+		}
+	}
+
+	Common::sort(candidates.begin(), candidates.end());
+}
+
 Object *Area::checkCollisionRay(const Math::Ray &ray, int raySize) {
 	float distance = 1.0;
 	float size = 16.0 * 8192.0; // TODO: check if this is the max size
 	Math::AABB boundingBox(ray.getOrigin(), ray.getOrigin());
 	Object *collided = nullptr;
-	for (auto &obj : _drawableObjects) {
+
+	Math::AABB region = boundingBox;
+	region.expand(ray.getOrigin() + raySize * ray.getDirection());
+	Common::Array<uint16> candidates;
+	gatherCollisionCandidates(region, candidates);
+
+	for (auto &index : candidates) {
+		Object *obj = _drawableObjects[index];
 		if (obj->getType() == kLineType)
 			// If the line is not along an axis, the AABB is wildly inaccurate so we skip it
 			if (((GeometricObject *)obj)->isLineButNotStraight())
@@ -413,7 +563,11 @@ Object *Area::checkCollisionRay(const Math::Ray &ray, int raySize) {
 
 ObjectArray Area::checkCollisions(const Math::AABB &boundingBox) {
 	ObjectArray collided;
-	for (auto &obj : _drawableObjects) {
+	Common::Array<uint16> candidates;
+	gatherCollisionCandidates(boundingBox, candidates);
+
+	for (auto &index : candidates) {
+		Object *obj = _drawableObjects[index];
 		if (!obj->isDestroyed() && !obj->isInvisible()) {
 			GeometricObject *gobj = (GeometricObject *)obj;
 			if (gobj->collides(boundingBox)) {
@@ -433,12 +587,19 @@ Math::Vector3d Area::resolveCollisions(const Math::Vector3d &lastPosition_, cons
 
 	float epsilon = 1.5;
 	int i = 0;
+	Common::Array<uint16> candidates;
 	while (true) {
 		float distance = 1.0;
 		Math::Vector3d normal;
 		Math::Vector3d direction = position - lastPosition;
 
-		for (auto &obj : _drawableObjects) {
+		Math::AABB region = boundingBox;
+		region.expand(boundingBox.getMin() + direction);
+		region.expand(boundingBox.getMax() + direction);
+		gatherCollisionCandidates(region, candidates);
+
+		for (auto &index : candidates) {
+			Object *obj = _drawableObjects[index];
 			if (!obj->isDestroyed() && !obj->isInvisible()) {
 				GeometricObject *gobj = (GeometricObject *)obj;
 				Math::Vector3d collidedNormal;
@@ -460,22 +621,20 @@ Math::Vector3d Area::resolveCollisions(const Math::Vector3d &lastPosition_, cons
 bool Area::checkInSight(const Math::Ray &ray, float maxDistance) {
 	Math::Vector3d direction = ray.getDirection();
 	direction.normalize();
-	GeometricObject point(kCubeType,
-			0,
-			0,
-			Math::Vector3d(0, 0, 0),
-			Math::Vector3d(maxDistance / 30, maxDistance / 30, maxDistance / 30), // size
-			nullptr,
-			nullptr,
-			nullptr,
-			FCLInstructionVector(),
-			"");
+	// A plain box rather than a probe object, moving one would mark the
+	// collision grid stale
+	Math::Vector3d size(maxDistance / 30, maxDistance / 30, maxDistance / 30);
+	Common::Array<uint16> candidates;
 
 	for (int distanceMultiplier = 2; distanceMultiplier <= 10; distanceMultiplier++) {
 		Math::Vector3d origin = ray.getOrigin() + distanceMultiplier * (maxDistance / 10) * direction;
-		point.setOrigin(origin);
+		Math::AABB point;
+		point.expand(origin);
+		point.expand(origin + size);
+		gatherCollisionCandidates(point, candidates);
 
-		for (auto &obj : _drawableObjects) {
+		for (auto &index : candidates) {
+			Object *obj = _drawableObjects[index];
 			if (obj->getType() != kSensorType && !obj->isDestroyed() && !obj->isInvisible() && obj->_boundingBox.isValid() && point.collides(obj->_boundingBox)) {
 				return false;
 			}
@@ -491,8 +650,10 @@ void Area::addObject(Object *obj) {
 	debugC(1, kFreescapeDebugParser, "Adding object %d to room %d", id, _areaID);
 	assert(!_objectsByID->contains(id));
 	(*_objectsByID)[id] = obj;
-	if (obj->isDrawable())
+	if (obj->isDrawable()) {
 		_drawableObjects.insert_at(0, obj);
+		_gridValid = false;
+	}
 
 	_addedObjects[id] = obj;
 }
@@ -502,6 +663,7 @@ void Area::removeObject(int16 id) {
 	for (uint i = 0; i < _drawableObjects.size(); i++) {
 		if (_drawableObjects[i]->getObjectID() == id) {
 			_drawableObjects.remove_at(i);
+			_gridValid = false;
 			break;
 		}
 	}
@@ -526,6 +688,7 @@ void Area::addObjectFromArea(int16 id, Area *global) {
 		_addedObjects[id] = obj;
 		if (obj->isDrawable()) {
 			_drawableObjects.insert_at(0, obj);
+			_gridValid = false;
 		}
 	}
 }
@@ -570,6 +733,7 @@ void Area::addFloor() {
 		FCLInstructionVector());
 	(*_objectsByID)[id] = obj;
 	_drawableObjects.insert_at(0, obj);
+	_gridValid = false;
 }
 
 void Area::addStructure(Area *global) {
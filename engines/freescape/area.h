@@ -101,6 +101,25 @@ private:
 	ObjectArray _drawableObjects;
 	ObjectMap _addedObjects;
 	Object *objectWithIDFromMap(ObjectMap *map, uint16 objectID);
+
+	// Uniform grid over the XZ plane holding indices into _drawableObjects,
+	// used to find the objects a collision query can touch. It is rebuilt
+	// lazily after objects are added, removed or moved. Destroyed and
+	// invisible objects stay in it, the queries skip them as before.
+	void updateCollisionGrid();
+	void gatherCollisionCandidates(const Math::AABB &region, Common::Array<uint16> &candidates);
+
+	bool _gridValid;
+	uint32 _gridGeneration;
+	float _gridCellSize;
+	float _gridOriginX;
+	float _gridOriginZ;
+	int _gridWidth;
+	int _gridHeight;
+	Common::Array<Common::Array<uint16> > _gridCells;
+	Common::Array<uint16> _gridOverflow; // objects without a usable box, or too large
+	Common::Array<uint32> _gridMarks;
+	uint32 _gridMark;
 };
 
 } // End of namespace Freescape
@@ -30,6 +30,8 @@ namespace Freescape {
 
 extern FCLInstructionVector *duplicateCondition(FCLInstructionVector *condition);
 
+uint32 GeometricObject::_boundingBoxGeneration = 0;
+
 int GeometricObject::numberOfColoursForObjectOfType(ObjectType type) {
 	switch (type) {
 	default:
@@ -272,6 +274,7 @@ Object *GeometricObject::duplicate() {
 }
 
 void GeometricObject::computeBoundingBox() {
+	_boundingBoxGeneration++;
 	_boundingBox = Math::AABB();
 	Math::Vector3d v;
 	switch (_type) {
@@ -38,6 +38,10 @@ public:
 	static bool isPyramid(ObjectType type);
 	static bool isPolygon(ObjectType type);
 
+	// Bumped every time a bounding box is recomputed, so the areas know
+	// when their collision grid went stale.
+	static uint32 _boundingBoxGeneration;
+
 	GeometricObject(
 		ObjectType type,
 		uint16 objectID,
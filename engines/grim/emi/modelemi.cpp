@@ -217,6 +217,8 @@ void EMIModel::setSkeleton(Skeleton *skel) {
 		return;
 	}
 	_skeleton = skel;
+	_skinnedPose = 0;
+	delete[] _skinMatrices; _skinMatrices = nullptr;
 	if (!skel || !_numBoneInfos) {
 		return;
 	}
@@ -225,12 +227,42 @@ void EMIModel::setSkeleton(Skeleton *skel) {
 	for (int i = 0; i < _numBoneInfos; i++) {
 		_vertexBoneInfo[i] = _skeleton->findJointIndex(_boneNames[_boneInfos[i]._joint]);
 	}
+	_skinMatrices = new Math::Matrix4[_skeleton->_numJoints];
 }
 
 void EMIModel::prepareForRender() {
 	if (!_skeleton || !_vertexBoneInfo)
 		return;
 
+	// Nothing to do while the skeleton holds the pose we last skinned for
+	if (_skinnedPose == _skeleton->_poseStamp)
+		return;
+	_skinnedPose = _skeleton->_poseStamp;
+
+	// Fold the inverse bind pose and the posed joint into one transform
+	// per joint, instead of decomposing both again for every bone weight.
+	// The rotation part applies to the normals as well.
+	for (int j = 0; j < _skeleton->_numJoints; j++) {
+		const Math::Matrix4 &jointMatrix = _skeleton->_joints[j]._finalMatrix;
+		const Math::Matrix4 &bindPose = _skeleton->_joints[j]._absMatrix;
+		const Math::Matrix3 bindRotation = bindPose.getRotation();
+		Math::Matrix4 &skin = _skinMatrices[j];
+
+		for (int axis = 0; axis < 3; axis++) {
+			Math::Vector3d column;
+			column.getData()[axis] = 1.0f;
+			column = column * bindRotation;
+			jointMatrix.transform(&column, false);
+			skin.setValue(0, axis, column.x());
+			skin.setValue(1, axis, column.y());
+			skin.setValue(2, axis, column.z());
+		}
+
+		Math::Vector3d origin = -bindPose.getPosition() * bindRotation;
+		jointMatrix.transform(&origin, true);
+		skin.setPosition(origin);
+	}
+
 	for (int i = 0; i < _numVertices; i++) {
 		_drawVertices[i].set(0.0f, 0.0f, 0.0f);
 		_drawNormals[i].set(0.0f, 0.0f, 0.0f);
@@ -242,20 +274,18 @@ void EMIModel::prepareForRender() {
 			boneVert++;
 		}
 
-		int jointIndex = _vertexBoneInfo[i];
-		const Math::Matrix4 &jointMatrix = _skeleton->_joints[jointIndex]._finalMatrix;
-		const Math::Matrix4 &bindPose = _skeleton->_joints[jointIndex]._absMatrix;
-
-		Math::Vector3d vert = _vertices[boneVert];
-		vert -= bindPose.getPosition();
-		vert = vert * bindPose.getRotation();
-		jointMatrix.transform(&vert, true);
-		_drawVertices[boneVert] += vert * _boneInfos[i]._weight;
-
-		Math::Vector3d normal = _normals[boneVert];
-		normal = normal * bindPose.getRotation();
-		jointMatrix.transform(&normal, false);
-		_drawNormals[boneVert] += normal * _boneInfos[i]._weight;
+		const float *m = _skinMatrices[_vertexBoneInfo[i]].getData();
+		const float weight = _boneInfos[i]._weight;
+		const float *v = _vertices[boneVert].getData();
+		const float *n = _normals[boneVert].getData();
+		float *dv = _drawVertices[boneVert].getData();
+		float *dn = _drawNormals[boneVert].getData();
+
+		for (int r = 0; r < 3; r++) {
+			const float *row = m + r * 4;
+			dv[r] += (row[0] * v[0] + row[1] * v[1] + row[2] * v[2] + row[3]) * weight;
+			dn[r] += (row[0] * n[0] + row[1] * n[1] + row[2] * n[2]) * weight;
+		}
 	}
 
 	for (int i = 0; i < _numVertices; i++) {
@@ -443,6 +473,8 @@ EMIModel::EMIModel(const Common::String &filename, Common::SeekableReadStream *d
 	_boneInfos = nullptr;
 	_numBoneInfos = 0;
 	_vertexBoneInfo = nullptr;
+	_skinMatrices = nullptr;
+	_skinnedPose = 0;
 	_skeleton = nullptr;
 	_radius = 0;
 	_center = new Math::Vector3d();
@@ -473,6 +505,7 @@ EMIModel::~EMIModel() {
 	delete[] _mats;
 	delete[] _boneInfos;
 	delete[] _vertexBoneInfo;
+	delete[] _skinMatrices;
 	delete[] _boneNames;
 	delete[] _lighting;
 	delete[] _texFlags;
@@ -115,6 +115,11 @@ public:
 	Common::String *_boneNames;
 	int *_vertexBoneInfo;
 
+	// Per joint bind-to-posed transforms, and the skeleton pose the draw
+	// vertices were last skinned for
+	Math::Matrix4 *_skinMatrices;
+	uint32 _skinnedPose;
+
 	// Stuff we dont know how to use:
 	float _radius;
 	Math::Vector3d *_center;
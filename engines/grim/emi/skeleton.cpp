@@ -35,7 +35,7 @@ namespace Grim {
 #define TRANSLATE_OP 3
 
 Skeleton::Skeleton(const Common::String &filename, Common::SeekableReadStream *data) :
-		_numJoints(0), _joints(nullptr), _animLayers(nullptr) {
+		_numJoints(0), _joints(nullptr), _poseStamp(1), _animLayers(nullptr) {
 	loadSkeleton(data);
 }
 
@@ -172,16 +172,27 @@ void Skeleton::removeAnimation(AnimationStateEmi *anim) {
 }
 
 void Skeleton::commitAnim() {
+	bool changed = false;
+
 	for (int m = 0; m < _numJoints; ++m) {
 		const Joint *parent = getParentJoint(&_joints[m]);
+		Math::Matrix4 finalMatrix;
 		if (parent) {
-			_joints[m]._finalMatrix = parent->_finalMatrix * _joints[m]._animMatrix;
+			finalMatrix = parent->_finalMatrix * _joints[m]._animMatrix;
 			_joints[m]._finalQuat = parent->_finalQuat * _joints[m]._animQuat;
 		} else {
-			_joints[m]._finalMatrix = _joints[m]._animMatrix;
+			finalMatrix = _joints[m]._animMatrix;
 			_joints[m]._finalQuat = _joints[m]._animQuat;
 		}
+
+		if (!(finalMatrix == _joints[m]._finalMatrix)) {
+			_joints[m]._finalMatrix = finalMatrix;
+			changed = true;
+		}
 	}
+
+	if (changed)
+		_poseStamp++;
 }
 
 int Skeleton::findJointIndex(const Common::String &name) const {
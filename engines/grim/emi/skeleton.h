@@ -81,6 +81,10 @@ public:
 	typedef Common::HashMap<Common::String, int, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> JointMap;
 	JointMap _jointsMap;
 
+	// Bumped whenever commitAnim() changes any of the final joint matrices,
+	// so skinned meshes can tell when they have to be transformed again.
+	uint32 _poseStamp;
+
 	Skeleton(const Common::String &filename, Common::SeekableReadStream *data);
 	~Skeleton();
 	void animate();
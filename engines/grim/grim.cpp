@@ -369,6 +369,7 @@ Common::Error GrimEngine::run() {
 			}
 		}
 
+		MD5Check::forgetVerified();
 		ConfMan.setBool("check_gamedata", false);
 		ConfMan.flushToDisk();
 	}
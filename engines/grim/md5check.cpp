@@ -19,8 +19,11 @@
  *
  */
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/md5.h"
+#include "common/system.h"
+#include "common/tokenizer.h"
 #include "common/translation.h"
 
 #include "gui/error.h"
@@ -420,6 +423,19 @@ const char *emi_installer[] = {
 bool MD5Check::_initted = false;
 Common::Array<MD5Check::MD5Sum> *MD5Check::_files = nullptr;
 int MD5Check::_iterator = -1;
+MD5Check::VerifiedMap *MD5Check::_verified = nullptr;
+bool MD5Check::_skipVerified = false;
+uint MD5Check::_unsaved = 0;
+uint32 MD5Check::_lastSave = 0;
+
+// Files which passed the check, as "name:size:md5" entries separated by
+// commas, so running it again after it was stopped or problems were reported
+// only hashes the files which did not pass yet.
+static const char *const kVerifiedKey = "check_gamedata_verified";
+// The record is written out after this many newly verified files, or when
+// this many milliseconds went by since it last was.
+static const uint kSaveEveryFiles = 16;
+static const uint32 kSaveInterval = 3000;
 
 void MD5Check::init() {
 	if (_initted) {
@@ -553,9 +569,78 @@ void MD5Check::init() {
 void MD5Check::clear() {
 	delete _files;
 	_files = nullptr;
+	delete _verified;
+	_verified = nullptr;
 	_initted = false;
 }
 
+void MD5Check::loadVerified() {
+	if (!_verified)
+		_verified = new VerifiedMap();
+	_verified->clear();
+
+	if (!ConfMan.hasKey(kVerifiedKey))
+		return;
+
+	Common::StringTokenizer tokenizer(ConfMan.get(kVerifiedKey), ",");
+	while (!tokenizer.empty()) {
+		Common::String entry = tokenizer.nextToken();
+		// entries without a sum are from older versions and get hashed again
+		size_t md5Sep = entry.findLastOf(':');
+		if (md5Sep == Common::String::npos || md5Sep == 0)
+			continue;
+		size_t sizeSep = entry.findLastOf(':', md5Sep - 1);
+		if (sizeSep == Common::String::npos)
+			continue;
+		VerifiedFile &file = (*_verified)[Common::String(entry.c_str(), sizeSep)];
+		file.size = (uint32)atol(entry.c_str() + sizeSep + 1);
+		file.md5 = entry.c_str() + md5Sep + 1;
+	}
+	_unsaved = 0;
+	_lastSave = g_system->getMillis();
+}
+
+void MD5Check::markVerified(const char *filename, uint32 size, const Common::String &md5) {
+	if (!_verified)
+		return;
+	VerifiedFile &file = (*_verified)[filename];
+	file.size = size;
+	file.md5 = md5;
+	_unsaved++;
+
+	if (_unsaved >= kSaveEveryFiles || g_system->getMillis() - _lastSave >= kSaveInterval)
+		saveVerified();
+}
+
+void MD5Check::saveVerified() {
+	if (!_verified)
+		return;
+
+	Common::String value;
+	for (VerifiedMap::const_iterator i = _verified->begin(); i != _verified->end(); ++i) {
+		if (!value.empty())
+			value += ',';
+		value += Common::String::format("%s:%u:%s", i->_key.c_str(), i->_value.size, i->_value.md5.c_str());
+	}
+	ConfMan.set(kVerifiedKey, value);
+	ConfMan.flushToDisk();
+	_unsaved = 0;
+	_lastSave = g_system->getMillis();
+}
+
+void MD5Check::saveProgress() {
+	if (_unsaved)
+		saveVerified();
+}
+
+void MD5Check::forgetVerified() {
+	if (_verified)
+		_verified->clear();
+	_unsaved = 0;
+	if (ConfMan.hasKey(kVerifiedKey))
+		ConfMan.removeKey(kVerifiedKey, ConfMan.getActiveDomainName());
+}
+
 bool MD5Check::checkMD5(const MD5Sum &sums, const char *md5) {
 	for (int i = 0; i < sums.numSums; ++i) {
 		if (strcmp(sums.sums[i], md5) == 0) {
@@ -575,8 +660,11 @@ bool MD5Check::checkFiles() {
 	return ok;
 }
 
-void MD5Check::startCheckFiles() {
+void MD5Check::startCheckFiles(bool skipVerified) {
 	init();
+	_skipVerified = skipVerified;
+	if (_skipVerified)
+		loadVerified();
 	_iterator = 0;
 }
 
@@ -596,8 +684,24 @@ bool MD5Check::advanceCheck(int *pos, int *total) {
 		_iterator = -1;
 	}
 
+	bool ok = checkFile(sum);
+
+	if (_iterator == -1)
+		saveProgress();
+
+	return ok;
+}
+
+bool MD5Check::checkFile(const MD5Sum &sum) {
 	Common::File file;
 	if (file.open(sum.filename)) {
+		uint32 size = (uint32)file.size();
+		if (_skipVerified && _verified && _verified->contains(sum.filename)) {
+			const VerifiedFile &verified = (*_verified)[sum.filename];
+			if (verified.size == size && checkMD5(sum, verified.md5.c_str()))
+				return true;
+		}
+
 		Common::String md5 = Common::computeStreamMD5AsString(file);
 		if (!checkMD5(sum, md5.c_str())) {
 			warning("'%s' may be corrupted. MD5: '%s'", sum.filename, md5.c_str());
@@ -606,6 +710,8 @@ bool MD5Check::advanceCheck(int *pos, int *total) {
 									"description of your game version (i.e. dvd-box or jewelcase):\n%s"), sum.filename, md5.c_str()));
 			return false;
 		}
+		if (_skipVerified)
+			markVerified(sum.filename, size, md5);
 	} else {
 		Common::String urlForRequiredDataFiles = Common::String::format("https://wiki.scummvm.org/index.php?title=%s#Required_data_files",
 		                                                                (g_grim->getGameType() == GType_GRIM)? "Grim_Fandango" : "Escape_from_Monkey_Island");
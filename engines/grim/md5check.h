@@ -23,19 +23,32 @@
 #define GRIM_MD5CHECK_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 
 namespace Grim {
 
 class MD5Check {
 public:
 	static bool checkFiles();
-	static void startCheckFiles();
+	// With skipVerified set, files which passed an earlier check that was
+	// not cleared are not hashed again, as long as they still have the size
+	// they had then. The progress is saved while the check runs.
+	static void startCheckFiles(bool skipVerified = false);
 	static bool advanceCheck(int *pos, int *total);
 	inline static bool advanceCheck() { return advanceCheck(NULL, NULL); }
+	// Writes out the files verified since the last save, so a check stopped
+	// before its end goes on from there the next time.
+	static void saveProgress();
 	static void clear();
+	// Drops the record of files verified so far, once the check is over.
+	static void forgetVerified();
 
 private:
 	static void init();
+	static void loadVerified();
+	static void markVerified(const char *filename, uint32 size, const Common::String &md5);
+	static void saveVerified();
 
 	struct MD5Sum {
 		MD5Sum(const char *fn, const char **s, int n) : filename(fn), sums(s), numSums(n) {}
@@ -44,10 +57,21 @@ private:
 		int numSums;
 	};
 	static bool checkMD5(const MD5Sum &sums, const char *md5);
+	static bool checkFile(const MD5Sum &sum);
 
 	static bool _initted;
 	static Common::Array<MD5Sum> *_files;
 	static int _iterator;
+
+	struct VerifiedFile {
+		uint32 size;
+		Common::String md5;
+	};
+	typedef Common::HashMap<Common::String, VerifiedFile, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> VerifiedMap;
+	static VerifiedMap *_verified;
+	static bool _skipVerified;
+	static uint _unsaved;
+	static uint32 _lastSave;
 };
 
 }
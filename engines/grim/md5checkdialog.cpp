@@ -79,7 +79,13 @@ MD5CheckDialog::MD5CheckDialog() :
 
 void MD5CheckDialog::check() {
 	_checkOk = true;
-	MD5Check::startCheckFiles();
+	MD5Check::startCheckFiles(true);
+}
+
+void MD5CheckDialog::close() {
+	// also reached when the engine is quit in the middle of the check
+	MD5Check::saveProgress();
+	GUI::Dialog::close();
 }
 
 void MD5CheckDialog::handleTickle() {
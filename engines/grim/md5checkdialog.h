@@ -36,6 +36,8 @@ class MD5CheckDialog : public GUI::Dialog {
 public:
 	MD5CheckDialog();
 
+	void close() override;
+
 protected:
 	void handleTickle() override;
 
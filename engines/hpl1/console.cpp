@@ -0,0 +1,98 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "hpl1/console.h"
+#include "common/random.h"
+#include "common/system.h"
+#include "hpl1/engine/ai/AINodeContainer.h"
+#include "hpl1/engine/ai/AStar.h"
+#include "hpl1/engine/game/Game.h"
+#include "hpl1/engine/scene/Scene.h"
+#include "hpl1/engine/scene/World3D.h"
+#include "hpl1/penumbra-overture/Init.h"
+
+namespace Hpl1 {
+
+Console::Console(cInit *init) : GUI::Debugger(), _init(init) {
+	registerCmd("astar_benchmark", WRAP_METHOD(Console, cmdAStarBenchmark));
+}
+
+Console::~Console() {
+}
+
+// Runs path searches between random nodes of every AI node container of
+// the loaded map. The queries are seeded the same way every time, so runs
+// on the same map can be compared.
+bool Console::cmdAStarBenchmark(int argc, const char **argv) {
+	if (argc != 2) {
+		debugPrintf("usage: %s queries\n", argv[0]);
+		return true;
+	}
+
+	hpl::cWorld3D *world = _init->mpGame->GetScene()->GetWorld3D();
+	if (!world) {
+		debugPrintf("No map is loaded\n");
+		return true;
+	}
+
+	int queries = atoi(argv[1]);
+	hpl::tAINodeContainerList *containers = world->GetAINodeContainerList();
+	if (containers->empty()) {
+		debugPrintf("The map has no AI node containers\n");
+		return true;
+	}
+
+	for (hpl::tAINodeContainerListIt it = containers->begin(); it != containers->end(); ++it) {
+		hpl::cAINodeContainer *container = *it;
+		int nodeNum = container->GetNodeNum();
+		if (nodeNum < 2) {
+			debugPrintf("%s: %d nodes, skipped\n", container->GetName().c_str(), nodeNum);
+			continue;
+		}
+
+		Common::RandomSource rnd("hpl1_astar_benchmark");
+		rnd.setSeed(0);
+		hpl::cAStarHandler astar(container);
+		hpl::tAINodeList path;
+		int found = 0;
+		uint pathNodes = 0;
+
+		uint32 start = g_system->getMillis();
+		for (int i = 0; i < queries; i++) {
+			hpl::cAINode *startNode = container->GetNode(rnd.getRandomNumber(nodeNum - 1));
+			hpl::cAINode *goalNode = container->GetNode(rnd.getRandomNumber(nodeNum - 1));
+			path.clear();
+			if (astar.GetPath(startNode->GetPosition(), goalNode->GetPosition(), &path)) {
+				found++;
+				pathNodes += path.size();
+			}
+		}
+		uint32 time = g_system->getMillis() - start;
+
+		debugPrintf("%s: %d nodes, %d queries, %d paths found (%u nodes), %u ms, %.3f ms per query\n",
+					container->GetName().c_str(), nodeNum, queries, found, pathNodes, time,
+					queries > 0 ? (double)time / queries : 0.0);
+	}
+
+	return true;
+}
+
+} // End of namespace Hpl1
@@ -47,6 +47,7 @@ namespace hpl {
 //-----------------------------------------------------------------------
 
 cAINode::cAINode() {
+	mlIndex = -1;
 }
 
 //-----------------------------------------------------------------------
@@ -144,18 +145,18 @@ cAINodeIterator::cAINodeIterator(cAINodeContainer *apContainer, const cVector3f
 	mvEndGridPos = mpContainer->GetGridPosFromLocal(vLocalEnd);
 	mvGridPos = mvStartGridPos;
 
-	mpNodeList = &mpContainer->GetGrid(mvGridPos)->mlstNodes;
-	while (mpNodeList->empty()) {
+	mpNodeVec = &mpContainer->GetGrid(mvGridPos)->mvNodes;
+	while (mpNodeVec->empty()) {
 		if (IncGridPos()) {
-			mpNodeList = &mpContainer->GetGrid(mvGridPos)->mlstNodes;
+			mpNodeVec = &mpContainer->GetGrid(mvGridPos)->mvNodes;
 		} else {
-			mpNodeList = NULL;
+			mpNodeVec = NULL;
 			break;
 		}
 	}
 
-	if (mpNodeList) {
-		mNodeIt = mpNodeList->begin();
+	if (mpNodeVec) {
+		mNodeIt = mpNodeVec->begin();
 	}
 
 	// Log("--------------------------------------\n");
@@ -166,7 +167,7 @@ cAINodeIterator::cAINodeIterator(cAINodeContainer *apContainer, const cVector3f
 //-----------------------------------------------------------------------
 
 bool cAINodeIterator::HasNext() {
-	if (mpNodeList == NULL || mpNodeList->empty())
+	if (mpNodeVec == NULL || mpNodeVec->empty())
 		return false;
 
 	return true;
@@ -178,23 +179,23 @@ cAINode *cAINodeIterator::Next() {
 	cAINode *pNode = *mNodeIt;
 
 	++mNodeIt;
-	if (mNodeIt == mpNodeList->end()) {
+	if (mNodeIt == mpNodeVec->end()) {
 		if (IncGridPos()) {
-			mpNodeList = &mpContainer->GetGrid(mvGridPos)->mlstNodes;
-			while (mpNodeList->empty()) {
+			mpNodeVec = &mpContainer->GetGrid(mvGridPos)->mvNodes;
+			while (mpNodeVec->empty()) {
 				if (IncGridPos()) {
-					mpNodeList = &mpContainer->GetGrid(mvGridPos)->mlstNodes;
+					mpNodeVec = &mpContainer->GetGrid(mvGridPos)->mvNodes;
 				} else {
-					mpNodeList = NULL;
+					mpNodeVec = NULL;
 					break;
 				}
 			}
 		} else {
-			mpNodeList = NULL;
+			mpNodeVec = NULL;
 		}
 
-		if (mpNodeList)
-			mNodeIt = mpNodeList->begin();
+		if (mpNodeVec)
+			mNodeIt = mpNodeVec->begin();
 	}
 
 	return pNode;
@@ -269,6 +270,7 @@ void cAINodeContainer::AddNode(const tString &asName, const cVector3f &avPositio
 	pNode->msName = asName;
 	pNode->mvPosition = avPosition;
 	pNode->mpUserData = apUserData;
+	pNode->mlIndex = (int)mvNodes.size();
 
 	mvNodes.push_back(pNode);
 	m_mapNodes.insert(tAINodeMap::value_type(asName, pNode));
@@ -454,7 +456,7 @@ void cAINodeContainer::BuildNodeGridMap() {
 				vLocalPos.ToString().c_str(),
 				vGridPos.x, vGridPos.y);
 
-		mvGrids[vGridPos.y * (mvGridMapSize.x + 1) + vGridPos.x].mlstNodes.push_back(pNode);
+		mvGrids[vGridPos.y * (mvGridMapSize.x + 1) + vGridPos.x].mvNodes.push_back(pNode);
 	}
 }
 
@@ -78,9 +78,15 @@ public:
 
 	const tString &GetName() { return msName; }
 
+	/**
+	 * Index of the node in its container.
+	 */
+	int GetIndex() const { return mlIndex; }
+
 private:
 	tString msName;
 	cVector3f mvPosition;
+	int mlIndex;
 	void *mpUserData;
 
 	tAINodeEdgeVec mvEdges;
@@ -126,7 +132,7 @@ private:
 
 class cAIGridNode {
 public:
-	tAINodeList mlstNodes;
+	tAINodeVec mvNodes;
 };
 
 //--------------------------------
@@ -149,8 +155,8 @@ private:
 	cVector2l mvEndGridPos;
 	cVector2l mvGridPos;
 
-	tAINodeList *mpNodeList;
-	tAINodeListIt mNodeIt;
+	tAINodeVec *mpNodeVec;
+	tAINodeVecIt mNodeIt;
 };
 
 //--------------------------------
@@ -41,15 +41,25 @@ namespace hpl {
 
 //-----------------------------------------------------------------------
 
-cAStarNode::cAStarNode(cAINode *apAINode) {
+cAStarNode::cAStarNode() {
+	mfCost = 0;
+	mfDistance = 0;
 	mpParent = NULL;
-	mpAINode = apAINode;
+	mpAINode = NULL;
+	mlSearch = 0;
+	mbOpen = false;
+	mbClosed = false;
+	mbGoal = false;
 }
 
 //-----------------------------------------------------------------------
 
-bool cAStarNodeCompare::operator()(cAStarNode *apNodeA, cAStarNode *apNodeB) const {
-	return apNodeA->mpAINode < apNodeB->mpAINode;
+// Orders the open heap on cost. Ties go to the node added to the container
+// first so the result does not depend on the order nodes were opened in.
+static inline bool IsBetterNode(const cAStarNode *apNodeA, const cAStarNode *apNodeB) {
+	if (apNodeA->mfCost != apNodeB->mfCost)
+		return apNodeA->mfCost < apNodeB->mfCost;
+	return apNodeA->mpAINode->GetIndex() < apNodeB->mpAINode->GetIndex();
 }
 
 //-----------------------------------------------------------------------
@@ -66,13 +76,13 @@ cAStarHandler::cAStarHandler(cAINodeContainer *apContainer) {
 	mpContainer = apContainer;
 
 	mpCallback = NULL;
+
+	mlSearchCount = 0;
 }
 
 //-----------------------------------------------------------------------
 
 cAStarHandler::~cAStarHandler() {
-	STLDeleteAll(m_setClosedList);
-	STLDeleteAll(m_setOpenList);
 }
 
 //-----------------------------------------------------------------------
@@ -93,10 +103,18 @@ bool cAStarHandler::GetPath(const cVector3f &avStart, const cVector3f &avGoal, t
 
 	////////////////////////////////////////////////
 	// Reset all variables
-	// These should just be cleared and pools used instead.
-	STLDeleteAll(m_setClosedList);
-	STLDeleteAll(m_setOpenList);
-	m_setGoalNodes.clear();
+	// Bumping the search count invalidates the state left in the nodes by earlier searches.
+	if ((int)mvNodes.size() != mpContainer->GetNodeNum()) {
+		mvNodes.clear();
+		mvNodes.resize(mpContainer->GetNodeNum());
+		mlSearchCount = 0;
+	}
+	if (++mlSearchCount == 0) {
+		for (size_t i = 0; i < mvNodes.size(); ++i)
+			mvNodes[i].mlSearch = 0;
+		mlSearchCount = 1;
+	}
+	mvOpenHeap.clear();
 	mpGoalNode = NULL;
 
 	// Set goal position
@@ -141,7 +159,7 @@ bool cAStarHandler::GetPath(const cVector3f &avStart, const cVector3f &avGoal, t
 		if (fDist < fMaxDist && fHeight <= fMaxHeight) {
 			// Check if path is clear
 			if (mpContainer->FreePath(avGoal, pAINode->GetPosition(), 3)) {
-				m_setGoalNodes.insert(pAINode);
+				GetSearchNode(pAINode)->mbGoal = true;
 			}
 		}
 	}
@@ -211,13 +229,13 @@ bool cAStarHandler::GetPath(const cVector3f &avStart, const cVector3f &avGoal, t
 
 void cAStarHandler::IterateAlgorithm() {
 	int lIterationCount = 0;
-	while (m_setOpenList.empty() == false && (mlMaxIterations < 0 || lIterationCount < mlMaxIterations)) {
+	while (mvOpenHeap.empty() == false && (mlMaxIterations < 0 || lIterationCount < mlMaxIterations)) {
 		cAStarNode *pNode = GetBestNode();
 		cAINode *pAINode = pNode->mpAINode;
 
 		//////////////////////
 		// Check if current node can reach goal
-		if (IsGoalNode(pAINode)) {
+		if (pNode->mbGoal) {
 			mpGoalNode = pNode;
 			break;
 		}
@@ -240,54 +258,76 @@ void cAStarHandler::IterateAlgorithm() {
 
 //-----------------------------------------------------------------------
 
+cAStarNode *cAStarHandler::GetSearchNode(cAINode *apAINode) {
+	cAStarNode *pNode = &mvNodes[apAINode->GetIndex()];
+	if (pNode->mlSearch != mlSearchCount) {
+		pNode->mlSearch = mlSearchCount;
+		pNode->mpAINode = apAINode;
+		pNode->mpParent = NULL;
+		pNode->mbOpen = false;
+		pNode->mbClosed = false;
+		pNode->mbGoal = false;
+	}
+	return pNode;
+}
+
+//-----------------------------------------------------------------------
+
 void cAStarHandler::AddOpenNode(cAINode *apAINode, cAStarNode *apParent, float afDistance) {
 	// TODO: free path check with dynamic objects here.
 
-	// TODO: Some pooling here would be good.
-	cAStarNode *pNode = hplNew(cAStarNode, (apAINode));
+	cAStarNode *pNode = GetSearchNode(apAINode);
 
-	// Check if it is in closed list.
-	tAStarNodeSetIt it = m_setClosedList.find(pNode);
-	if (it != m_setClosedList.end()) {
-		hplDelete(pNode);
+	// Skip it if it is in the closed list or was already inserted.
+	if (pNode->mbOpen || pNode->mbClosed)
 		return;
-	}
-
-	// Add it if it wasn't already inserted
-	const auto test = m_setOpenList.find(pNode);
-	if (test != m_setOpenList.end()) {
-		hplDelete(pNode);
-		return;
-	}
-	m_setOpenList.insert(pNode);
+	pNode->mbOpen = true;
 
 	pNode->mfDistance = afDistance;
 	pNode->mfCost = Cost(afDistance, apAINode, apParent) + Heuristic(pNode->mpAINode->GetPosition(), mvGoal);
 	pNode->mpParent = apParent;
+
+	// Sift the node up the heap.
+	size_t lPos = mvOpenHeap.size();
+	mvOpenHeap.push_back(pNode);
+	while (lPos > 0) {
+		size_t lParent = (lPos - 1) / 2;
+		if (!IsBetterNode(pNode, mvOpenHeap[lParent]))
+			break;
+		mvOpenHeap[lPos] = mvOpenHeap[lParent];
+		lPos = lParent;
+	}
+	mvOpenHeap[lPos] = pNode;
 }
 
 //-----------------------------------------------------------------------
 
 cAStarNode *cAStarHandler::GetBestNode() {
-	tAStarNodeSetIt it = m_setOpenList.begin();
-	tAStarNodeSetIt bestIt = it;
-	cAStarNode *pBestNode = *it;
-	++it;
-
-	// Iterate open list and find the best node.
-	for (; it != m_setOpenList.end(); ++it) {
-		cAStarNode *pNode = *it;
-		if (pBestNode->mfCost > pNode->mfCost) {
-			pBestNode = pNode;
-			bestIt = it;
+	cAStarNode *pBestNode = mvOpenHeap[0];
+
+	// Remove node from open, moving the last node down from the top.
+	cAStarNode *pLast = mvOpenHeap.back();
+	mvOpenHeap.pop_back();
+	size_t lCount = mvOpenHeap.size();
+	if (lCount > 0) {
+		size_t lPos = 0;
+		while (true) {
+			size_t lChild = lPos * 2 + 1;
+			if (lChild >= lCount)
+				break;
+			if (lChild + 1 < lCount && IsBetterNode(mvOpenHeap[lChild + 1], mvOpenHeap[lChild]))
+				++lChild;
+			if (!IsBetterNode(mvOpenHeap[lChild], pLast))
+				break;
+			mvOpenHeap[lPos] = mvOpenHeap[lChild];
+			lPos = lChild;
 		}
+		mvOpenHeap[lPos] = pLast;
 	}
 
-	// Remove node from open
-	m_setOpenList.erase(bestIt);
-
 	// Add to closed list
-	m_setClosedList.insert(pBestNode);
+	pBestNode->mbOpen = false;
+	pBestNode->mbClosed = true;
 
 	return pBestNode;
 }
@@ -309,15 +349,5 @@ float cAStarHandler::Heuristic(const cVector3f &avStart, const cVector3f &avGoal
 	return cMath::Vector3Dist(avStart, avGoal);
 }
 
-//-----------------------------------------------------------------------
-
-bool cAStarHandler::IsGoalNode(cAINode *apAINode) {
-	tAINodeSetIt it = m_setGoalNodes.find(apAINode);
-	if (it == m_setGoalNodes.end())
-		return false;
-
-	return true;
-}
-
 //-----------------------------------------------------------------------
 } // namespace hpl
@@ -28,6 +28,7 @@
 #ifndef HPL_A_STAR_H
 #define HPL_A_STAR_H
 
+#include "common/array.h"
 #include "common/list.h"
 #include "hpl1/engine/game/GameTypes.h"
 #include "hpl1/engine/math/MathTypes.h"
@@ -52,22 +53,23 @@ typedef tAINodeList::iterator tAINodeListIt;
 
 class cAStarNode {
 public:
-	cAStarNode(cAINode *apAINode);
+	cAStarNode();
 
 	float mfCost;
 	float mfDistance;
 
 	cAStarNode *mpParent;
 	cAINode *mpAINode;
-};
 
-class cAStarNodeCompare {
-public:
-	bool operator()(cAStarNode *apNodeA, cAStarNode *apNodeB) const;
+	// Search the node was last touched by, the other members are only valid for that one.
+	unsigned int mlSearch;
+	bool mbOpen;
+	bool mbClosed;
+	bool mbGoal;
 };
 
-typedef Hpl1::Std::set<cAStarNode *, cAStarNodeCompare> tAStarNodeSet;
-typedef tAStarNodeSet::iterator tAStarNodeSetIt;
+typedef Common::Array<cAStarNode> tAStarNodeVec;
+typedef Common::Array<cAStarNode *> tAStarNodePtrVec;
 
 //--------------------------------------
 class cAStarHandler;
@@ -99,6 +101,8 @@ public:
 private:
 	void IterateAlgorithm();
 
+	cAStarNode *GetSearchNode(cAINode *apAINode);
+
 	void AddOpenNode(cAINode *apAINode, cAStarNode *apParent, float afDistance);
 
 	cAStarNode *GetBestNode();
@@ -106,12 +110,9 @@ private:
 	float Cost(float afDistance, cAINode *apAINode, cAStarNode *apParent);
 	float Heuristic(const cVector3f &avStart, const cVector3f &avGoal);
 
-	bool IsGoalNode(cAINode *apAINode);
-
 	cVector3f mvGoal;
 
 	cAStarNode *mpGoalNode;
-	tAINodeSet m_setGoalNodes;
 
 	cAINodeContainer *mpContainer;
 
@@ -119,8 +120,13 @@ private:
 
 	iAStarCallback *mpCallback;
 
-	tAStarNodeSet m_setOpenList;
-	tAStarNodeSet m_setClosedList;
+	// One node per container node, reused between searches. A node belongs to the
+	// current search when its mlSearch matches mlSearchCount.
+	tAStarNodeVec mvNodes;
+	unsigned int mlSearchCount;
+
+	// Binary heap ordered on cost.
+	tAStarNodePtrVec mvOpenHeap;
 };
 
 } // namespace hpl
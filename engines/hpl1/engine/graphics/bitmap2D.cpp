@@ -35,7 +35,9 @@ static Image::ImageDecoder *loadImage(const tString &filepath, Image::ImageDecod
 	Common::File imgFile;
 	if (!imgFile.open(Common::Path(filepath)))
 		error("Could not open file: %s", filepath.c_str());
-	if (!decoder->loadStream(imgFile))
+	// Read the file in one go rather than through the many small reads the decoders do
+	Common::ScopedPtr<Common::SeekableReadStream> imgData(imgFile.readStream(imgFile.size()));
+	if (!imgData || !decoder->loadStream(*imgData))
 		error("Could not load image at %s", filepath.c_str());
 	return decoder;
 }
@@ -160,9 +162,17 @@ void Bitmap2D::copyRedToAlpha() {
 }
 
 void Bitmap2D::copyDecoder(const Graphics::PixelFormat &format) {
-	_surface.copyFrom(*(_decoder->getSurface()));
-	if (format.bytesPerPixel != 0)
-		_surface.convertToInPlace(format);
+	const Graphics::Surface *decoded = _decoder->getSurface();
+	if (format.bytesPerPixel != 0 && decoded->format.bytesPerPixel > 1) {
+		// Convert in a single pass instead of copying the pixels first
+		Graphics::Surface *converted = decoded->convertTo(format);
+		_surface = *converted;
+		delete converted;
+	} else {
+		_surface.copyFrom(*decoded);
+		if (format.bytesPerPixel != 0)
+			_surface.convertToInPlace(format);
+	}
 	_isSurfaceActive = true;
 	_decoder.reset(nullptr);
 }
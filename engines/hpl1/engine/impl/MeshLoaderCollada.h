@@ -37,6 +37,11 @@
 
 class TiXmlElement;
 
+namespace Common {
+class SeekableReadStream;
+class WriteStream;
+}
+
 namespace hpl {
 
 class cMesh;
@@ -434,6 +439,8 @@ public:
 
 	void AddSupportedTypes(tStringVec *avFileTypes);
 
+	bool BuildCache(const tString &asFile);
+
 private:
 	bool mbZToY;
 
@@ -497,24 +504,37 @@ private:
 						cColladaScene *apColladaScene,
 						bool abCache);
 
-	bool SaveStructures(const tString &asFile,
-						tColladaImageVec *apColladaImageVec,
-						tColladaTextureVec *apColladaTextureVec,
-						tColladaMaterialVec *apColladaMaterialVec,
-						tColladaLightVec *apColladaLightVec,
-						tColladaGeometryVec *apColladaGeometryVec,
-						tColladaControllerVec *apColladaControllerVec,
-						tColladaAnimationVec *apColladaAnimVec,
+	bool ParseStructures(const tString &asFile,
+						 Common::SeekableReadStream &aSource,
+						 tColladaImageVec *apColladaImageVec,
+						 tColladaTextureVec *apColladaTextureVec,
+						 tColladaMaterialVec *apColladaMaterialVec,
+						 tColladaLightVec *apColladaLightVec,
+						 tColladaGeometryVec *apColladaGeometryVec,
+						 tColladaControllerVec *apColladaControllerVec,
+						 tColladaAnimationVec *apColladaAnimVec,
+						 cColladaScene *apColladaScene);
+
+	void SaveStructures(Common::WriteStream *apStream,
+						uint32 alSourceSize, uint32 alSourceHash,
+						tColladaImageVec &avColladaImageVec,
+						tColladaTextureVec &avColladaTextureVec,
+						tColladaMaterialVec &avColladaMaterialVec,
+						tColladaLightVec &avColladaLightVec,
+						tColladaGeometryVec &avColladaGeometryVec,
+						tColladaControllerVec &avColladaControllerVec,
+						tColladaAnimationVec &avColladaAnimVec,
 						cColladaScene *apColladaScene);
 
-	bool LoadStructures(const tString &asFile,
-						tColladaImageVec *apColladaImageVec,
-						tColladaTextureVec *apColladaTextureVec,
-						tColladaMaterialVec *apColladaMaterialVec,
-						tColladaLightVec *apColladaLightVec,
-						tColladaGeometryVec *apColladaGeometryVec,
-						tColladaControllerVec *apColladaControllerVec,
-						tColladaAnimationVec *apColladaAnimVec,
+	bool LoadStructures(Common::SeekableReadStream *apStream,
+						uint32 alSourceSize, uint32 alSourceHash,
+						tColladaImageVec &avColladaImageVec,
+						tColladaTextureVec &avColladaTextureVec,
+						tColladaMaterialVec &avColladaMaterialVec,
+						tColladaLightVec &avColladaLightVec,
+						tColladaGeometryVec &avColladaGeometryVec,
+						tColladaControllerVec &avColladaControllerVec,
+						tColladaAnimationVec &avColladaAnimVec,
 						cColladaScene *apColladaScene);
 
 	void LoadColladaScene(TiXmlElement *apRootElem, cColladaNode *apParentNode, cColladaScene *apScene,
@@ -27,6 +27,13 @@
 
 #include "hpl1/engine/impl/MeshLoaderCollada.h"
 
+#include "common/crc.h"
+#include "common/file.h"
+#include "common/memstream.h"
+#include "common/savefile.h"
+#include "common/system.h"
+#include "hpl1/hpl1.h"
+
 #include "hpl1/engine/graphics/LowLevelGraphics.h"
 #include "hpl1/engine/graphics/VertexBuffer.h"
 #include "hpl1/engine/system/String.h"
@@ -51,6 +58,19 @@ namespace hpl {
 
 //------------------------------------------------------------------------
 
+// Bump whenever the cache layout, or the way the structures are filled
+// from the XML, changes. Caches with another version are rebuilt.
+static const uint32 kColladaCacheVersion = 1;
+
+// The processed structures are cached in the save directory, shared by
+// all targets of the same game.
+static tString GetCacheFileName(const tString &asFile) {
+	return Common::String::format("%s-%s.dcache", Hpl1::g_engine->getGameId().c_str(),
+								  cString::ToLowerCase(cString::GetFileName(asFile)).c_str());
+}
+
+//------------------------------------------------------------------------
+
 //////////////////////////////////////////////////////////////////////////
 // FILL STRUCTURES
 //////////////////////////////////////////////////////////////////////////
@@ -66,47 +86,161 @@ bool cMeshLoaderCollada::FillStructures(const tString &asFile,
 										tColladaControllerVec *apColladaControllerVec,
 										tColladaAnimationVec *apColladaAnimVec,
 										cColladaScene *apColladaScene, bool abCache) {
-	abCache = false; // FIXME: find a way to enable the use of cache files
-	bool bLoadCache = false;
-	// abCache = false;
 	// Log("Loading %s\n",asFile.c_str());
 
-	tString sCacheFile = cString::GetFileName(cString::SetFileExt(asFile, "collcach"));
-	sCacheFile = "core/cache/" + sCacheFile;
+	/////////////////////////////////////////////////
+	// READ THE SOURCE
+	// The whole file is read at once, the cache is keyed by its hash and the
+	// XML parser can work from the same buffer if the cache is out of date.
+	Common::File file;
+	if (!file.open(Common::Path(asFile))) {
+		Error("Couldn't load Collada XML file '%s'!\n", asFile.c_str());
+		return false;
+	}
+
+	uint32 lSourceSize = file.size();
+	byte *pSourceData = (byte *)malloc(lSourceSize);
+	if (pSourceData == NULL || file.read(pSourceData, lSourceSize) != lSourceSize) {
+		Error("Couldn't load Collada XML file '%s'!\n", asFile.c_str());
+		free(pSourceData);
+		return false;
+	}
+	file.close();
 
-	if (abCache &&
-		FileExists(cString::To16Char(sCacheFile)) &&
-		FileExists(cString::To16Char(asFile))) {
-		cDate colladaDate = FileModifiedDate(cString::To16Char(asFile));
-		cDate cacheDate = FileModifiedDate(cString::To16Char(sCacheFile));
+	Common::MemoryReadStream source(pSourceData, lSourceSize, DisposeAfterUse::YES);
 
-		// Check if cache is newer
-		if (cacheDate > colladaDate)
-			bLoadCache = true;
+	if (abCache == false) {
+		return ParseStructures(asFile, source, apColladaImageVec, apColladaTextureVec,
+							   apColladaMaterialVec, apColladaLightVec,
+							   apColladaGeometryVec, apColladaControllerVec,
+							   apColladaAnimVec, apColladaScene);
 	}
 
 	/////////////////////////////////////////////////
 	// LOAD CACHE
-	if (bLoadCache) {
-		return LoadStructures(sCacheFile,
-							  apColladaImageVec,
-							  apColladaTextureVec,
-							  apColladaMaterialVec,
-							  apColladaLightVec,
-							  apColladaGeometryVec,
-							  apColladaControllerVec,
-							  apColladaAnimVec,
-							  apColladaScene);
-	} else if (abCache) {
-		Log("Cache out of date! Reloading collada file '%s'\n and generating cache files", asFile.c_str());
+	// The cache always holds every library of the file, loaded with the
+	// lights, so that meshes, worlds and animations can share it. Only the
+	// parts requested are handed out.
+	uint32 lSourceHash = Common::CRC32().crcFast(pSourceData, lSourceSize);
+	tString sCacheFile = GetCacheFileName(asFile);
+
+	tColladaImageVec vImages;
+	tColladaTextureVec vTextures;
+	tColladaMaterialVec vMaterials;
+	tColladaLightVec vLights;
+	tColladaGeometryVec vGeometries;
+	tColladaControllerVec vControllers;
+	tColladaAnimationVec vAnimations;
+	cColladaScene LocalScene;
+	cColladaScene *pScene = apColladaScene ? apColladaScene : &LocalScene;
+
+	bool bLoaded = false;
+	Common::ScopedPtr<Common::InSaveFile> pCacheFile(g_system->getSavefileManager()->openForLoading(sCacheFile));
+	Common::ScopedPtr<Common::SeekableReadStream> pCache(pCacheFile ? pCacheFile->readStream(pCacheFile->size()) : NULL);
+	pCacheFile.reset();
+	if (pCache) {
+		bLoaded = LoadStructures(pCache.get(), lSourceSize, lSourceHash, vImages, vTextures, vMaterials,
+								 vLights, vGeometries, vControllers, vAnimations, pScene);
+		if (bLoaded == false) {
+			Log("Cache out of date! Reloading collada file '%s'\n", asFile.c_str());
+			vImages.clear();
+			vTextures.clear();
+			vMaterials.clear();
+			vLights.clear();
+			vGeometries.clear();
+			vControllers.clear();
+			vAnimations.clear();
+			pScene->ResetNodes();
+		}
+	}
+	pCache.reset();
+
+	if (bLoaded == false) {
+		if (ParseStructures(asFile, source, &vImages, &vTextures, &vMaterials, &vLights,
+							&vGeometries, &vControllers, &vAnimations, pScene) == false)
+			return false;
+
+		Common::MemoryWriteStreamDynamic cacheData(DisposeAfterUse::YES);
+		SaveStructures(&cacheData, lSourceSize, lSourceHash, vImages, vTextures, vMaterials,
+					   vLights, vGeometries, vControllers, vAnimations, pScene);
+
+		Common::ScopedPtr<Common::OutSaveFile> pOutCache(g_system->getSavefileManager()->openForSaving(sCacheFile, false));
+		if (pOutCache) {
+			pOutCache->write(cacheData.getData(), cacheData.size());
+			pOutCache->finalize();
+			if (pOutCache->err()) {
+				Warning("Couldn't write collada cache '%s'\n", sCacheFile.c_str());
+				pOutCache.reset();
+				g_system->getSavefileManager()->removeSavefile(sCacheFile);
+			}
+		}
+	}
+
+	// Without a light list, the scale of light nodes ends up in their
+	// transform, which the cached scene does not have.
+	if (apColladaLightVec == NULL && vLights.empty() == false) {
+		pScene->ResetNodes();
+		source.seek(0);
+		return ParseStructures(asFile, source, apColladaImageVec, apColladaTextureVec,
+							   apColladaMaterialVec, apColladaLightVec,
+							   apColladaGeometryVec, apColladaControllerVec,
+							   apColladaAnimVec, apColladaScene);
 	}
 
+	// Hand out the same libraries ParseStructures() would have loaded
+	if (apColladaImageVec)
+		apColladaImageVec->swap(vImages);
+	if (apColladaTextureVec)
+		apColladaTextureVec->swap(vTextures);
+	if (apColladaMaterialVec)
+		apColladaMaterialVec->swap(vMaterials);
+	if (apColladaLightVec)
+		apColladaLightVec->swap(vLights);
+	if (apColladaGeometryVec)
+		apColladaGeometryVec->swap(vGeometries);
+	if (apColladaGeometryVec && apColladaControllerVec)
+		apColladaControllerVec->swap(vControllers);
+	if (apColladaScene && apColladaAnimVec)
+		apColladaAnimVec->swap(vAnimations);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------
+
+bool cMeshLoaderCollada::BuildCache(const tString &asFile) {
+	tColladaImageVec vImages;
+	tColladaTextureVec vTextures;
+	tColladaMaterialVec vMaterials;
+	tColladaLightVec vLights;
+	tColladaGeometryVec vGeometries;
+	tColladaControllerVec vControllers;
+	tColladaAnimationVec vAnimations;
+	cColladaScene ColladaScene;
+
+	Log("Building collada cache for '%s'\n", asFile.c_str());
+	return FillStructures(asFile, &vImages, &vTextures, &vMaterials, &vLights,
+						  &vGeometries, &vControllers, &vAnimations, &ColladaScene, true);
+}
+
+//-----------------------------------------------------------------------
+
+bool cMeshLoaderCollada::ParseStructures(const tString &asFile,
+										 Common::SeekableReadStream &aSource,
+										 tColladaImageVec *apColladaImageVec,
+										 tColladaTextureVec *apColladaTextureVec,
+										 tColladaMaterialVec *apColladaMaterialVec,
+										 tColladaLightVec *apColladaLightVec,
+										 tColladaGeometryVec *apColladaGeometryVec,
+										 tColladaControllerVec *apColladaControllerVec,
+										 tColladaAnimationVec *apColladaAnimVec,
+										 cColladaScene *apColladaScene) {
 	/////////////////////////////////////////////////
 	// LOAD THE DOCUMENT
 	// unsigned long lStartTime = mpSystem->GetLowLevel()->GetTime();
 
 	TiXmlDocument *pXmlDoc = hplNew(TiXmlDocument, (asFile.c_str()));
-	if (pXmlDoc->LoadFile() == false) {
+	if (pXmlDoc->LoadFile(aSource) == false) {
 		Error("Couldn't load Collada XML file '%s'!\n", asFile.c_str());
 		hplDelete(pXmlDoc);
 		return false;
@@ -263,1102 +397,541 @@ bool cMeshLoaderCollada::FillStructures(const tString &asFile,
 		pLibraryElem = pLibraryElem->NextSiblingElement();
 	}
 
-	if (abCache) {
-		SaveStructures(sCacheFile, apColladaImageVec,
-					   apColladaTextureVec,
-					   apColladaMaterialVec,
-					   apColladaLightVec,
-					   apColladaGeometryVec,
-					   apColladaControllerVec,
-					   apColladaAnimVec,
-					   apColladaScene);
-	}
 	hplDelete(pXmlDoc);
 	return true;
 }
 
-//--------------------------------------------------------------------------
+//-----------------------------------------------------------------------
 
 //////////////////////////////////////////////////////////////////////////
-// SAVE COLLADA DATA
+// COLLADA CACHE
 //////////////////////////////////////////////////////////////////////////
 
-#define CreateXMLChild(parent, name) static_cast<TiXmlElement *>(parent->InsertEndChild(TiXmlElement(name)));
-
-#define CreateXMLTextChild(parent, name) static_cast<TiXmlText *>(parent->InsertEndChild(TiXmlText(name)));
-
 //-----------------------------------------------------------------------
 
-static void SaveImageVec(TiXmlElement *apRootElem, tColladaImageVec *apColladaImageVec);
-static void SaveTextureVec(TiXmlElement *apRootElem, tColladaTextureVec *apColladaTextureVec);
-static void SaveMaterialVec(TiXmlElement *apRootElem, tColladaMaterialVec *apColladaMaterialVec);
-static void SaveLightVec(TiXmlElement *apRootElem, tColladaLightVec *apColladaLightVec);
-static void SaveAnimationVec(TiXmlElement *apRootElem, tColladaAnimationVec *apColladaAnimationVec);
-static void SaveControllerVec(TiXmlElement *apRootElem, tColladaControllerVec *apColladaControllerVec);
-static void SaveGeometryVec(TiXmlElement *apRootElem, tColladaGeometryVec *apColladaGeometryVec);
-static void SaveScene(TiXmlElement *apRootElem, cColladaScene *apColladaScene);
-
-bool cMeshLoaderCollada::SaveStructures(const tString &asFile,
-										tColladaImageVec *apColladaImageVec,
-										tColladaTextureVec *apColladaTextureVec,
-										tColladaMaterialVec *apColladaMaterialVec,
-										tColladaLightVec *apColladaLightVec,
-										tColladaGeometryVec *apColladaGeometryVec,
-										tColladaControllerVec *apColladaControllerVec,
-										tColladaAnimationVec *apColladaAnimVec,
-										cColladaScene *apColladaScene) {
-	TiXmlDocument *pXmlDoc = hplNew(TiXmlDocument, (asFile.c_str()));
-
-	TiXmlElement *pRootElem = CreateXMLChild(pXmlDoc, "ColladaCache");
-
-	if (apColladaImageVec)
-		SaveImageVec(pRootElem, apColladaImageVec);
-	if (apColladaTextureVec)
-		SaveTextureVec(pRootElem, apColladaTextureVec);
-	if (apColladaMaterialVec)
-		SaveMaterialVec(pRootElem, apColladaMaterialVec);
-	if (apColladaLightVec)
-		SaveLightVec(pRootElem, apColladaLightVec);
-	if (apColladaAnimVec)
-		SaveAnimationVec(pRootElem, apColladaAnimVec);
-	if (apColladaControllerVec)
-		SaveControllerVec(pRootElem, apColladaControllerVec);
-	if (apColladaGeometryVec)
-		SaveGeometryVec(pRootElem, apColladaGeometryVec);
-	if (apColladaScene)
-		SaveScene(pRootElem, apColladaScene);
-
-	if (pXmlDoc->SaveFile() == false) {
-		Error("Couldn't save XML file %s\n", asFile.c_str());
-		hplDelete(pXmlDoc);
-		return false;
-	}
-	hplDelete(pXmlDoc);
-	return true;
+static void WriteString(Common::WriteStream *apStream, const tString &asString) {
+	apStream->writeString(asString);
+	apStream->writeByte(0);
 }
 
-//-----------------------------------------------------------------------
-
-static void SaveImageVec(TiXmlElement *apRootElem, tColladaImageVec *apColladaImageVec) {
-	TiXmlElement *pImageRootElem = CreateXMLChild(apRootElem, "ImageRoot");
-
-	pImageRootElem->SetAttribute("Size", (int)apColladaImageVec->size());
-
-	for (size_t i = 0; i < apColladaImageVec->size(); ++i) {
-		cColladaImage *pImage = &(*apColladaImageVec)[i];
-
-		TiXmlElement *pImageElem = CreateXMLChild(pImageRootElem, "Image");
-
-		pImageElem->SetAttribute("Id", pImage->msId.c_str());
-		pImageElem->SetAttribute("Name", pImage->msName.c_str());
-		pImageElem->SetAttribute("Source", cString::GetFileName(pImage->msSource.c_str()).c_str());
-	}
+static void WriteVector3f(Common::WriteStream *apStream, const cVector3f &avVec) {
+	apStream->writeFloatLE(avVec.x);
+	apStream->writeFloatLE(avVec.y);
+	apStream->writeFloatLE(avVec.z);
 }
 
-//-----------------------------------------------------------------------
-
-static void SaveTextureVec(TiXmlElement *apRootElem, tColladaTextureVec *apColladaTextureVec) {
-	TiXmlElement *pTextureRootElem = CreateXMLChild(apRootElem, "TextureRoot");
-
-	pTextureRootElem->SetAttribute("Size", (int)apColladaTextureVec->size());
-
-	for (size_t i = 0; i < apColladaTextureVec->size(); ++i) {
-		cColladaTexture *pTexture = &(*apColladaTextureVec)[i];
-
-		TiXmlElement *pTextureElem = CreateXMLChild(pTextureRootElem, "Texture");
-
-		pTextureElem->SetAttribute("Id", pTexture->msId.c_str());
-		pTextureElem->SetAttribute("Name", pTexture->msName.c_str());
-		pTextureElem->SetAttribute("Image", pTexture->msImage.c_str());
-	}
+static void WriteColor(Common::WriteStream *apStream, const cColor &aColor) {
+	apStream->writeFloatLE(aColor.r);
+	apStream->writeFloatLE(aColor.g);
+	apStream->writeFloatLE(aColor.b);
+	apStream->writeFloatLE(aColor.a);
 }
 
-//-----------------------------------------------------------------------
-
-static void SaveMaterialVec(TiXmlElement *apRootElem, tColladaMaterialVec *apColladaMaterialVec) {
-	TiXmlElement *pMaterialRootElem = CreateXMLChild(apRootElem, "MaterialRoot");
-
-	pMaterialRootElem->SetAttribute("Size", (int)apColladaMaterialVec->size());
-
-	for (size_t i = 0; i < apColladaMaterialVec->size(); ++i) {
-		cColladaMaterial *pMaterial = &(*apColladaMaterialVec)[i];
-
-		TiXmlElement *pMaterialElem = CreateXMLChild(pMaterialRootElem, "Material");
-
-		pMaterialElem->SetAttribute("Id", pMaterial->msId.c_str());
-		pMaterialElem->SetAttribute("Name", pMaterial->msName.c_str());
-		pMaterialElem->SetAttribute("Texture", pMaterial->msTexture.c_str());
-		pMaterialElem->SetAttribute("Color", pMaterial->mDiffuseColor.ToFileString().c_str());
-	}
+static void WriteMatrix(Common::WriteStream *apStream, const cMatrixf &a_mtxMatrix) {
+	for (int i = 0; i < 16; ++i)
+		apStream->writeFloatLE(a_mtxMatrix.v[i]);
 }
 
-//-----------------------------------------------------------------------
-
-static void SaveLightVec(TiXmlElement *apRootElem, tColladaLightVec *apColladaLightVec) {
-	TiXmlElement *pLightRootElem = CreateXMLChild(apRootElem, "LightRoot");
-
-	pLightRootElem->SetAttribute("Size", (int)apColladaLightVec->size());
-
-	for (size_t i = 0; i < apColladaLightVec->size(); ++i) {
-		cColladaLight *pLight = &(*apColladaLightVec)[i];
+static void WriteFloatVec(Common::WriteStream *apStream, const tFloatVec &avValues) {
+	apStream->writeUint32LE(avValues.size());
+	for (size_t i = 0; i < avValues.size(); ++i)
+		apStream->writeFloatLE(avValues[i]);
+}
 
-		TiXmlElement *pLightElem = CreateXMLChild(pLightRootElem, "Light");
+static void WriteNodeChildren(Common::WriteStream *apStream, cColladaNode *apParentNode) {
+	apStream->writeUint32LE(apParentNode->mlstChildren.size());
 
-		// Log("Light %s\n",pLight->msName.c_str());
+	for (tColladaNodeListIt it = apParentNode->mlstChildren.begin(); it != apParentNode->mlstChildren.end(); ++it) {
+		cColladaNode *pNode = *it;
 
-		pLightElem->SetAttribute("Id", pLight->msId.c_str());
-		pLightElem->SetAttribute("Name", pLight->msName.c_str());
-		pLightElem->SetAttribute("Type", pLight->msType.c_str());
+		WriteString(apStream, pNode->msId);
+		WriteString(apStream, pNode->msName);
+		WriteString(apStream, pNode->msType);
+		WriteString(apStream, pNode->msSource);
+		apStream->writeByte(pNode->mbSourceIsFile ? 1 : 0);
+		WriteMatrix(apStream, pNode->m_mtxTransform);
+		WriteMatrix(apStream, pNode->m_mtxWorldTransform);
+		WriteVector3f(apStream, pNode->mvScale);
+		apStream->writeSint32LE(pNode->mlCount);
+
+		apStream->writeUint32LE(pNode->mlstTransforms.size());
+		for (tColladaTransformListIt transIt = pNode->mlstTransforms.begin(); transIt != pNode->mlstTransforms.end(); ++transIt) {
+			WriteString(apStream, transIt->msSid);
+			WriteString(apStream, transIt->msType);
+			WriteFloatVec(apStream, transIt->mvValues);
+		}
 
-		pLightElem->SetAttribute("Angle", cString::ToString(pLight->mfAngle).c_str());
-		pLightElem->SetAttribute("Color", pLight->mDiffuseColor.ToFileString().c_str());
+		WriteNodeChildren(apStream, pNode);
 	}
 }
 
 //-----------------------------------------------------------------------
 
-static void SaveAnimationVec(TiXmlElement *apRootElem, tColladaAnimationVec *apColladaAnimationVec) {
-	TiXmlElement *pAnimationRootElem = CreateXMLChild(apRootElem, "AnimationRoot");
-
-	pAnimationRootElem->SetAttribute("Size", (int)apColladaAnimationVec->size());
-
-	for (size_t i = 0; i < apColladaAnimationVec->size(); ++i) {
-		cColladaAnimation *pAnimation = &(*apColladaAnimationVec)[i];
-
-		TiXmlElement *pAnimationElem = CreateXMLChild(pAnimationRootElem, "Animation");
+void cMeshLoaderCollada::SaveStructures(Common::WriteStream *apStream,
+										uint32 alSourceSize, uint32 alSourceHash,
+										tColladaImageVec &avColladaImageVec,
+										tColladaTextureVec &avColladaTextureVec,
+										tColladaMaterialVec &avColladaMaterialVec,
+										tColladaLightVec &avColladaLightVec,
+										tColladaGeometryVec &avColladaGeometryVec,
+										tColladaControllerVec &avColladaControllerVec,
+										tColladaAnimationVec &avColladaAnimVec,
+										cColladaScene *apColladaScene) {
+	apStream->writeUint32BE(MKTAG('H', 'P', 'L', 'C'));
+	apStream->writeUint32LE(kColladaCacheVersion);
+	apStream->writeUint32LE(alSourceSize);
+	apStream->writeUint32LE(alSourceHash);
+
+	/////////////////////////////////////
+	// Images, textures and materials
+	apStream->writeUint32LE(avColladaImageVec.size());
+	for (size_t i = 0; i < avColladaImageVec.size(); ++i) {
+		WriteString(apStream, avColladaImageVec[i].msId);
+		WriteString(apStream, avColladaImageVec[i].msName);
+		WriteString(apStream, avColladaImageVec[i].msSource);
+	}
 
-		pAnimationElem->SetAttribute("Id", pAnimation->msId.c_str());
-		pAnimationElem->SetAttribute("TargetNode", pAnimation->msTargetNode.c_str());
+	apStream->writeUint32LE(avColladaTextureVec.size());
+	for (size_t i = 0; i < avColladaTextureVec.size(); ++i) {
+		WriteString(apStream, avColladaTextureVec[i].msId);
+		WriteString(apStream, avColladaTextureVec[i].msName);
+		WriteString(apStream, avColladaTextureVec[i].msImage);
+	}
 
-		/////////////////////////////////////
-		// Channels
-		{
-			TiXmlElement *pChannelVecElem = CreateXMLChild(pAnimationElem, "ChannelVec");
-			pChannelVecElem->SetAttribute("Size", (int)pAnimation->mvChannels.size());
+	apStream->writeUint32LE(avColladaMaterialVec.size());
+	for (size_t i = 0; i < avColladaMaterialVec.size(); ++i) {
+		WriteString(apStream, avColladaMaterialVec[i].msId);
+		WriteString(apStream, avColladaMaterialVec[i].msName);
+		WriteString(apStream, avColladaMaterialVec[i].msTexture);
+		WriteColor(apStream, avColladaMaterialVec[i].mDiffuseColor);
+	}
 
-			for (size_t idx = 0; idx < pAnimation->mvChannels.size(); ++idx) {
-				cColladaChannel *pChannel = &pAnimation->mvChannels[idx];
-				TiXmlElement *pChannelElem = CreateXMLChild(pChannelVecElem, "Channel");
+	/////////////////////////////////////
+	// Lights
+	apStream->writeUint32LE(avColladaLightVec.size());
+	for (size_t i = 0; i < avColladaLightVec.size(); ++i) {
+		WriteString(apStream, avColladaLightVec[i].msId);
+		WriteString(apStream, avColladaLightVec[i].msName);
+		WriteString(apStream, avColladaLightVec[i].msType);
+		WriteColor(apStream, avColladaLightVec[i].mDiffuseColor);
+		apStream->writeFloatLE(avColladaLightVec[i].mfAngle);
+	}
 
-				pChannelElem->SetAttribute("Id", pChannel->msId.c_str());
-				pChannelElem->SetAttribute("Target", pChannel->msTarget.c_str());
-				pChannelElem->SetAttribute("Source", pChannel->msSource.c_str());
-			}
-		}
-		/////////////////////////////////////
-		// Samplers
-		{
-			TiXmlElement *pSamplerVecElem = CreateXMLChild(pAnimationElem, "SamplerVec");
-			pSamplerVecElem->SetAttribute("Size", (int)pAnimation->mvSamplers.size());
-
-			for (size_t idx = 0; idx < pAnimation->mvSamplers.size(); ++idx) {
-				cColladaSampler *pSampler = &pAnimation->mvSamplers[idx];
-				TiXmlElement *pSamplerElem = CreateXMLChild(pSamplerVecElem, "Sampler");
-
-				pSamplerElem->SetAttribute("Id", pSampler->msId.c_str());
-				pSamplerElem->SetAttribute("TimeArray", pSampler->msTimeArray.c_str());
-				pSamplerElem->SetAttribute("ValueArray", pSampler->msValueArray.c_str());
-				pSamplerElem->SetAttribute("Target", pSampler->msTarget.c_str());
-			}
+	/////////////////////////////////////
+	// Geometries, the source arrays are only used while parsing
+	apStream->writeUint32LE(avColladaGeometryVec.size());
+	for (size_t i = 0; i < avColladaGeometryVec.size(); ++i) {
+		cColladaGeometry &Geom = avColladaGeometryVec[i];
+
+		WriteString(apStream, Geom.msId);
+		WriteString(apStream, Geom.msName);
+		WriteString(apStream, Geom.msMaterial);
+
+		apStream->writeUint32LE(Geom.mvVertexVec.size());
+		for (size_t j = 0; j < Geom.mvVertexVec.size(); ++j) {
+			const cVertex &Vtx = Geom.mvVertexVec[j];
+			WriteVector3f(apStream, Vtx.pos);
+			WriteVector3f(apStream, Vtx.tex);
+			WriteVector3f(apStream, Vtx.tan);
+			WriteVector3f(apStream, Vtx.norm);
+			WriteColor(apStream, Vtx.col);
 		}
-		/////////////////////////////////////
-		// Sources
-		{
-			TiXmlElement *pSourceVecElem = CreateXMLChild(pAnimationElem, "SourceVec");
-			pSourceVecElem->SetAttribute("Size", (int)pAnimation->mvSources.size());
-
-			for (size_t idx = 0; idx < pAnimation->mvSources.size(); ++idx) {
-				cColladaAnimSource *pSource = &pAnimation->mvSources[idx];
-				TiXmlElement *pSourceElem = CreateXMLChild(pSourceVecElem, "Source");
-
-				pSourceElem->SetAttribute("Id", pSource->msId.c_str());
-				tString sData = "";
-				for (size_t j = 0; j < pSource->mvValues.size(); ++j)
-					sData += cString::ToString(pSource->mvValues[j]) + " ";
-
-				pSourceElem->SetAttribute("Values", sData.c_str());
+
+		apStream->writeUint32LE(Geom.mvIndexVec.size());
+		for (size_t j = 0; j < Geom.mvIndexVec.size(); ++j)
+			apStream->writeUint32LE(Geom.mvIndexVec[j]);
+
+		WriteFloatVec(apStream, Geom.mvTangents);
+
+		apStream->writeUint32LE(Geom.mvExtraVtxVec.size());
+		for (size_t j = 0; j < Geom.mvExtraVtxVec.size(); ++j) {
+			tColladaExtraVtxList &lstExtra = Geom.mvExtraVtxVec[j];
+			apStream->writeUint32LE(lstExtra.size());
+			for (tColladaExtraVtxListIt it = lstExtra.begin(); it != lstExtra.end(); ++it) {
+				apStream->writeSint32LE(it->mlVtx);
+				apStream->writeSint32LE(it->mlNorm);
+				apStream->writeSint32LE(it->mlTex);
+				apStream->writeSint32LE(it->mlNewVtx);
 			}
 		}
 	}
-}
-
-//-----------------------------------------------------------------------
-
-static void SaveControllerVec(TiXmlElement *apRootElem, tColladaControllerVec *apColladaControllerVec) {
-	TiXmlElement *pControllerRootElem = CreateXMLChild(apRootElem, "ControllerRoot");
-
-	pControllerRootElem->SetAttribute("Size", (int)apColladaControllerVec->size());
-
-	for (size_t i = 0; i < apColladaControllerVec->size(); ++i) {
-		cColladaController *pController = &(*apColladaControllerVec)[i];
 
-		TiXmlElement *pControllerElem = CreateXMLChild(pControllerRootElem, "Controller");
-
-		pControllerElem->SetAttribute("Id", pController->msId.c_str());
-		pControllerElem->SetAttribute("Target", pController->msTarget.c_str());
-
-		pControllerElem->SetAttribute("BindShapeMatrix", pController->m_mtxBindShapeMatrix.ToFileString().c_str());
-
-		pControllerElem->SetAttribute("JointPairIdx", pController->mlJointPairIdx);
-		pControllerElem->SetAttribute("WeightPairIdx", pController->mlWeightPairIdx);
-
-		///////////////////////
-		// Joints
-		{
-			TiXmlElement *pJointsElem = CreateXMLChild(pControllerElem, "Joints");
-			pJointsElem->SetAttribute("Size", (int)pController->mvJoints.size());
-
-			tString sData;
-			for (size_t idx = 0; idx < pController->mvJoints.size(); ++idx) {
-				sData += pController->mvJoints[idx] + " ";
-			}
-			CreateXMLTextChild(pJointsElem, sData.c_str());
-		}
-		///////////////////////
-		// Weights
-		{
-			TiXmlElement *pWeightsElem = CreateXMLChild(pControllerElem, "Weights");
-			pWeightsElem->SetAttribute("Size", (int)pController->mvWeights.size());
-
-			tString sData = "";
-			for (size_t idx = 0; idx < pController->mvWeights.size(); ++idx) {
-				sData += cString::ToString(pController->mvWeights[idx]) + " ";
-			}
-			CreateXMLTextChild(pWeightsElem, sData.c_str());
-		}
-		///////////////////////
-		// Matrices
-		{
-			TiXmlElement *pMatricesElem = CreateXMLChild(pControllerElem, "Matrices");
-			pMatricesElem->SetAttribute("Size", (int)pController->mvMatrices.size());
-
-			tString sData = "";
-			for (size_t idx = 0; idx < pController->mvMatrices.size(); ++idx) {
-				sData += pController->mvMatrices[idx].ToFileString() + " ";
+	/////////////////////////////////////
+	// Controllers
+	apStream->writeUint32LE(avColladaControllerVec.size());
+	for (size_t i = 0; i < avColladaControllerVec.size(); ++i) {
+		cColladaController &Ctrl = avColladaControllerVec[i];
+
+		WriteString(apStream, Ctrl.msTarget);
+		WriteString(apStream, Ctrl.msId);
+		WriteMatrix(apStream, Ctrl.m_mtxBindShapeMatrix);
+		apStream->writeSint32LE(Ctrl.mlJointPairIdx);
+		apStream->writeSint32LE(Ctrl.mlWeightPairIdx);
+
+		apStream->writeUint32LE(Ctrl.mvJoints.size());
+		for (size_t j = 0; j < Ctrl.mvJoints.size(); ++j)
+			WriteString(apStream, Ctrl.mvJoints[j]);
+
+		WriteFloatVec(apStream, Ctrl.mvWeights);
+
+		apStream->writeUint32LE(Ctrl.mvMatrices.size());
+		for (size_t j = 0; j < Ctrl.mvMatrices.size(); ++j)
+			WriteMatrix(apStream, Ctrl.mvMatrices[j]);
+
+		apStream->writeUint32LE(Ctrl.mvPairs.size());
+		for (size_t j = 0; j < Ctrl.mvPairs.size(); ++j) {
+			tColladaJointPairList &lstPairs = Ctrl.mvPairs[j];
+			apStream->writeUint32LE(lstPairs.size());
+			for (tColladaJointPairListIt it = lstPairs.begin(); it != lstPairs.end(); ++it) {
+				apStream->writeSint32LE(it->mlJoint);
+				apStream->writeSint32LE(it->mlWeight);
 			}
-			CreateXMLTextChild(pMatricesElem, sData.c_str());
-		}
-		///////////////////////
-		// Pairs
-		{
-			TiXmlElement *pPairVecElem = CreateXMLChild(pControllerElem, "PairVec");
-			pPairVecElem->SetAttribute("Size", (int)pController->mvPairs.size());
-
-			tIntVec vPairNumVec;
-			Hpl1::resizeAndFill(vPairNumVec, pController->mvPairs.size(), 0);
-
-			////////////////////////////////
-			// The pair connections
-			int lCount = 0;
-			TiXmlElement *pPairsElem = CreateXMLChild(pPairVecElem, "Pairs");
-			tString sData = "";
-			for (size_t idx = 0; idx < pController->mvPairs.size(); ++idx) {
-				tColladaJointPairList *pList = &pController->mvPairs[idx];
-
-				for (tColladaJointPairListIt it = pList->begin(); it != pList->end(); ++it) {
-					cColladaJointPair &Pair = *it;
-					sData += cString::ToString(Pair.mlJoint) + " " + cString::ToString(Pair.mlWeight) + " ";
-					++lCount;
-					++vPairNumVec[idx];
-				}
-			}
-			CreateXMLTextChild(pPairsElem, sData.c_str());
-			pPairsElem->SetAttribute("Size", lCount);
-
-			////////////////////////////////
-			// The pair numbers
-			TiXmlElement *pPairNumElem = CreateXMLChild(pPairVecElem, "PairNum");
-			sData = "";
-			for (size_t idx = 0; idx < pController->mvPairs.size(); ++idx) {
-				sData += cString::ToString(vPairNumVec[idx]) + " ";
-			}
-			CreateXMLTextChild(pPairNumElem, sData.c_str());
 		}
 	}
-}
-
-//-----------------------------------------------------------------------
-
-static void SaveGeometryVec(TiXmlElement *apRootElem, tColladaGeometryVec *apColladaGeometryVec) {
-	TiXmlElement *pGeometryRootElem = CreateXMLChild(apRootElem, "GeometryRoot");
-
-	pGeometryRootElem->SetAttribute("Size", (int)apColladaGeometryVec->size());
-
-	for (size_t i = 0; i < apColladaGeometryVec->size(); ++i) {
-		cColladaGeometry *pGeometry = &(*apColladaGeometryVec)[i];
 
-		TiXmlElement *pGeometryElem = CreateXMLChild(pGeometryRootElem, "Geometry");
+	/////////////////////////////////////
+	// Animations
+	apStream->writeUint32LE(avColladaAnimVec.size());
+	for (size_t i = 0; i < avColladaAnimVec.size(); ++i) {
+		cColladaAnimation &Anim = avColladaAnimVec[i];
 
-		/////////////////////////////////7
-		// Main properties
-		pGeometryElem->SetAttribute("Id", pGeometry->msId.c_str());
-		pGeometryElem->SetAttribute("Name", pGeometry->msName.c_str());
+		WriteString(apStream, Anim.msId);
+		WriteString(apStream, Anim.msTargetNode);
 
-		pGeometryElem->SetAttribute("Material", pGeometry->msMaterial.c_str());
-
-		/////////////////////////////////
-		// Vertex properties
-		// Should not be needed.
-		/*pGeometryElem->SetAttribute("PosIdxNum",pGeometry->mlPosIdxNum);
-		pGeometryElem->SetAttribute("NormIdxNum",pGeometry->mlNormIdxNum);
-		pGeometryElem->SetAttribute("TexIdxNum",pGeometry->mlTexIdxNum);
-
-		pGeometryElem->SetAttribute("PosArrayIdx",pGeometry->mlPosArrayIdx);
-		pGeometryElem->SetAttribute("NormArrayIdx",pGeometry->mlNormArrayIdx);
-		pGeometryElem->SetAttribute("TexArrayIdx",pGeometry->mlTexArrayIdx); */
-
-		/////////////////////////////////
-		// Index Vec
-		TiXmlElement *pIndexVecElem = CreateXMLChild(pGeometryElem, "IndexVec");
-
-		pIndexVecElem->SetAttribute("Size", (int)pGeometry->mvIndexVec.size());
-
-		TiXmlElement *pIndicesDataElem = CreateXMLChild(pIndexVecElem, "Indices");
-
-		tString sIndexVec = "";
-		for (size_t j = 0; j < pGeometry->mvIndexVec.size(); ++j) {
-			sIndexVec += cString::ToString((int)pGeometry->mvIndexVec[j]) + " ";
-		}
-		TiXmlText *pIndecVecText = CreateXMLTextChild(pIndicesDataElem, "Data");
-		pIndecVecText->SetValue(sIndexVec.c_str());
-
-		/////////////////////////////////
-		// Vertex vec
-		TiXmlElement *pVertexVecElem = CreateXMLChild(pGeometryElem, "VertexVec");
-		pVertexVecElem->SetAttribute("Size", (int)pGeometry->mvVertexVec.size());
-		{
-			/////////////////////////////////
-			// Positions
-			tString sData = "";
-			for (size_t j = 0; j < pGeometry->mvVertexVec.size(); ++j) {
-				sData += pGeometry->mvVertexVec[j].pos.ToFileString() + " ";
-			}
-			TiXmlElement *pDataElem = CreateXMLChild(pVertexVecElem, "Positions");
-			TiXmlText *pVecText = CreateXMLTextChild(pDataElem, "Data");
-			pVecText->SetValue(sData.c_str());
-
-			/////////////////////////////////
-			// Normals
-			sData = "";
-			for (size_t j = 0; j < pGeometry->mvVertexVec.size(); ++j) {
-				sData += pGeometry->mvVertexVec[j].norm.ToFileString() + " ";
-			}
-			pDataElem = CreateXMLChild(pVertexVecElem, "Normals");
-			pVecText = CreateXMLTextChild(pDataElem, "Data");
-			pVecText->SetValue(sData.c_str());
-
-			/////////////////////////////////
-			// UVs
-			sData = "";
-			for (size_t j = 0; j < pGeometry->mvVertexVec.size(); ++j) {
-				sData += pGeometry->mvVertexVec[j].tex.ToFileString() + " ";
-			}
-			pDataElem = CreateXMLChild(pVertexVecElem, "UV");
-			pVecText = CreateXMLTextChild(pDataElem, "Data");
-			pVecText->SetValue(sData.c_str());
-
-			/////////////////////////////////
-			// Tangents
-			sData = "";
-			char sTemp[20];
-			for (size_t j = 0; j < pGeometry->mvTangents.size(); ++j) {
-				snprintf(sTemp, 20, "%g ", pGeometry->mvTangents[j]);
-				sData += sTemp;
-			}
-			pDataElem = CreateXMLChild(pVertexVecElem, "Tangents");
-			CreateXMLTextChild(pDataElem, sData.c_str());
+		apStream->writeUint32LE(Anim.mvChannels.size());
+		for (size_t j = 0; j < Anim.mvChannels.size(); ++j) {
+			WriteString(apStream, Anim.mvChannels[j].msId);
+			WriteString(apStream, Anim.mvChannels[j].msTarget);
+			WriteString(apStream, Anim.mvChannels[j].msSource);
 		}
 
-		/////////////////////////////////
-		// Extra vertex vec
-		// if(false)
-		{
-			TiXmlElement *pExtraVertexVecElem = CreateXMLChild(pGeometryElem, "ExtraVertexVec");
-			pExtraVertexVecElem->SetAttribute("Size", (int)pGeometry->mvExtraVtxVec.size());
-
-			tUIntVec vExtraNum;
-			Hpl1::resizeAndFill(vExtraNum, pGeometry->mvExtraVtxVec.size(), 0);
-
-			////////////////////////////
-			// Extra vertices
-			tString sData = "";
-			int lExtraCount = 0;
-			TiXmlElement *pExtraElem = CreateXMLChild(pExtraVertexVecElem, "ExtraVertex");
-			for (size_t idx = 0; idx < pGeometry->mvExtraVtxVec.size(); ++idx) {
-				tColladaExtraVtxList *pList = &pGeometry->mvExtraVtxVec[idx];
-
-				tColladaExtraVtxListIt it = pList->begin();
-				for (; it != pList->end(); ++it) {
-					cColladaExtraVtx &extra = *it;
-					sData += cString::ToString(extra.mlVtx) + " " +
-							 cString::ToString(extra.mlNorm) + " " +
-							 cString::ToString(extra.mlTex) + " " +
-							 cString::ToString(extra.mlNewVtx) + " ";
-					++lExtraCount;
-					++vExtraNum[idx];
-				}
-			}
-			CreateXMLTextChild(pExtraElem, sData.c_str());
-			pExtraElem->SetAttribute("Size", (int)lExtraCount);
-
-			////////////////////////////
-			// Extra num
-			sData = "";
-			TiXmlElement *pExtraNumElem = CreateXMLChild(pExtraVertexVecElem, "ExtraNum");
-			for (size_t idx = 0; idx < pGeometry->mvExtraVtxVec.size(); ++idx) {
-				sData += cString::ToString((int)vExtraNum[idx]) + " ";
-			}
-			CreateXMLTextChild(pExtraNumElem, sData.c_str());
+		apStream->writeUint32LE(Anim.mvSamplers.size());
+		for (size_t j = 0; j < Anim.mvSamplers.size(); ++j) {
+			WriteString(apStream, Anim.mvSamplers[j].msId);
+			WriteString(apStream, Anim.mvSamplers[j].msTimeArray);
+			WriteString(apStream, Anim.mvSamplers[j].msValueArray);
+			WriteString(apStream, Anim.mvSamplers[j].msTarget);
 		}
-	}
-}
-
-//-----------------------------------------------------------------------
-
-static void SaveIterativeNode(TiXmlElement *apParentElem, cColladaNode *apParentNode) {
-	tColladaNodeListIt it = apParentNode->mlstChildren.begin();
-	for (; it != apParentNode->mlstChildren.end(); ++it) {
-		cColladaNode *pNode = *it;
-		TiXmlElement *pNodeElem = CreateXMLChild(apParentElem, "Node");
-
-		pNodeElem->SetAttribute("Id", pNode->msId.c_str());
-		pNodeElem->SetAttribute("Name", pNode->msName.c_str());
-		pNodeElem->SetAttribute("Type", pNode->msType.c_str());
-
-		pNodeElem->SetAttribute("Source", pNode->msSource.c_str());
-		pNodeElem->SetAttribute("SourceIsFile", pNode->mbSourceIsFile ? "true" : "false");
-
-		pNodeElem->SetAttribute("Transform", pNode->m_mtxTransform.ToFileString().c_str());
-		pNodeElem->SetAttribute("WorldTransform", pNode->m_mtxWorldTransform.ToFileString().c_str());
-
-		pNodeElem->SetAttribute("Scale", pNode->mvScale.ToFileString().c_str());
-
-		pNodeElem->SetAttribute("Count", pNode->mlCount);
-
-		TiXmlElement *pTransformRootElem = CreateXMLChild(pNodeElem, "TransformRoot");
-		// tColladaTransformList mlstTransforms;
-		tColladaTransformListIt transIt = pNode->mlstTransforms.begin();
-		for (; transIt != pNode->mlstTransforms.end(); ++transIt) {
-			cColladaTransform &transform = *transIt;
-			TiXmlElement *pTransformElem = CreateXMLChild(pTransformRootElem, "Transform");
-
-			pTransformElem->SetAttribute("Sid", transform.msSid.c_str());
-			pTransformElem->SetAttribute("Type", transform.msType.c_str());
-
-			tString sValues = "";
-			for (size_t i = 0; i < transform.mvValues.size(); ++i)
-				sValues += cString::ToString(transform.mvValues[i]) + " ";
 
-			pTransformElem->SetAttribute("Values", sValues.c_str());
+		apStream->writeUint32LE(Anim.mvSources.size());
+		for (size_t j = 0; j < Anim.mvSources.size(); ++j) {
+			WriteString(apStream, Anim.mvSources[j].msId);
+			WriteFloatVec(apStream, Anim.mvSources[j].mvValues);
 		}
-
-		SaveIterativeNode(pNodeElem, pNode);
 	}
-}
-
-static void SaveScene(TiXmlElement *apRootElem, cColladaScene *apColladaScene) {
-	TiXmlElement *pSceneElem = CreateXMLChild(apRootElem, "Scene");
-
-	pSceneElem->SetAttribute("StartTime", cString::ToString(apColladaScene->mfStartTime).c_str());
-	pSceneElem->SetAttribute("EndTime", cString::ToString(apColladaScene->mfEndTime).c_str());
-	pSceneElem->SetAttribute("DeltaTime", cString::ToString(apColladaScene->mfDeltaTime).c_str());
-
-	TiXmlElement *pSceneRootElem = CreateXMLChild(pSceneElem, "Root");
 
-	SaveIterativeNode(pSceneRootElem, &apColladaScene->mRoot);
+	/////////////////////////////////////
+	// Scene
+	apStream->writeFloatLE(apColladaScene->mfStartTime);
+	apStream->writeFloatLE(apColladaScene->mfEndTime);
+	apStream->writeFloatLE(apColladaScene->mfDeltaTime);
+	WriteNodeChildren(apStream, &apColladaScene->mRoot);
 }
 
 //-----------------------------------------------------------------------
 
-//////////////////////////////////////////////////////////////////////////
-// LOAD COLLADA DATA
-//////////////////////////////////////////////////////////////////////////
-
-//-----------------------------------------------------------------------
+static cVector3f ReadVector3f(Common::SeekableReadStream *apStream) {
+	cVector3f vVec;
+	vVec.x = apStream->readFloatLE();
+	vVec.y = apStream->readFloatLE();
+	vVec.z = apStream->readFloatLE();
+	return vVec;
+}
 
-static void LoadImageVec(TiXmlElement *apRootElem, tColladaImageVec *apColladaImageVec);
-static void LoadTextureVec(TiXmlElement *apRootElem, tColladaTextureVec *apColladaTextureVec);
-static void LoadMaterialVec(TiXmlElement *apRootElem, tColladaMaterialVec *apColladaMaterialVec);
-static void LoadLightVec(TiXmlElement *apRootElem, tColladaLightVec *apColladaLightVec);
-static void LoadAnimationVec(TiXmlElement *apRootElem, tColladaAnimationVec *apColladaAnimVec);
-static void LoadControllerVec(TiXmlElement *apRootElem, tColladaControllerVec *apColladaControllerVec);
-static void LoadGeometryVec(TiXmlElement *apRootElem, tColladaGeometryVec *apColladaGeometryVec);
-static void LoadScene(TiXmlElement *apRootElem, cColladaScene *apColladaScene);
+static cColor ReadColor(Common::SeekableReadStream *apStream) {
+	cColor Color;
+	Color.r = apStream->readFloatLE();
+	Color.g = apStream->readFloatLE();
+	Color.b = apStream->readFloatLE();
+	Color.a = apStream->readFloatLE();
+	return Color;
+}
 
-bool cMeshLoaderCollada::LoadStructures(const tString &asFile,
-										tColladaImageVec *apColladaImageVec,
-										tColladaTextureVec *apColladaTextureVec,
-										tColladaMaterialVec *apColladaMaterialVec,
-										tColladaLightVec *apColladaLightVec,
-										tColladaGeometryVec *apColladaGeometryVec,
-										tColladaControllerVec *apColladaControllerVec,
-										tColladaAnimationVec *apColladaAnimVec,
-										cColladaScene *apColladaScene) {
-	// unsigned long lStartTime = mpSystem->GetLowLevel()->GetTime();
+static cMatrixf ReadMatrix(Common::SeekableReadStream *apStream) {
+	cMatrixf mtxMatrix;
+	for (int i = 0; i < 16; ++i)
+		mtxMatrix.v[i] = apStream->readFloatLE();
+	return mtxMatrix;
+}
 
-	TiXmlDocument *pXmlDoc = hplNew(TiXmlDocument, (asFile.c_str()));
-	if (pXmlDoc->LoadFile() == false) {
-		Warning("Couldn't open XML file %s\n", asFile.c_str());
-		hplDelete(pXmlDoc);
+// Reads an element count and checks that many elements of at least
+// alElementSize bytes can still be in the stream, so a damaged cache
+// cannot make us allocate huge arrays.
+static bool ReadCount(Common::SeekableReadStream *apStream, uint32 alElementSize, uint32 &alCount) {
+	alCount = apStream->readUint32LE();
+	if (apStream->eos() || apStream->err())
 		return false;
-	}
-
-	// unsigned long lTime = mpSystem->GetLowLevel()->GetTime() - lStartTime;
-	// Log("Loading cached collada XML file '%s' took: %d ms\n",asFile.c_str(),lTime);
 
-	TiXmlElement *pRootElem = pXmlDoc->RootElement();
+	return (uint64)alCount * alElementSize <= (uint64)(apStream->size() - apStream->pos());
+}
 
-	if (apColladaImageVec)
-		LoadImageVec(pRootElem, apColladaImageVec);
-	if (apColladaTextureVec)
-		LoadTextureVec(pRootElem, apColladaTextureVec);
-	if (apColladaMaterialVec)
-		LoadMaterialVec(pRootElem, apColladaMaterialVec);
-	if (apColladaLightVec)
-		LoadLightVec(pRootElem, apColladaLightVec);
-	if (apColladaAnimVec)
-		LoadAnimationVec(pRootElem, apColladaAnimVec);
-	if (apColladaControllerVec)
-		LoadControllerVec(pRootElem, apColladaControllerVec);
-	if (apColladaGeometryVec)
-		LoadGeometryVec(pRootElem, apColladaGeometryVec);
-	if (apColladaScene)
-		LoadScene(pRootElem, apColladaScene);
+static bool ReadFloatVec(Common::SeekableReadStream *apStream, tFloatVec &avValues) {
+	uint32 lCount;
+	if (!ReadCount(apStream, sizeof(float), lCount))
+		return false;
 
-	hplDelete(pXmlDoc);
+	avValues.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i)
+		avValues[i] = apStream->readFloatLE();
 	return true;
 }
 
-//-----------------------------------------------------------------------
-
-static void LoadImageVec(TiXmlElement *apRootElem, tColladaImageVec *apColladaImageVec) {
-	TiXmlElement *pImageRootElem = apRootElem->FirstChildElement("ImageRoot");
-
-	int lSize = cString::ToInt(pImageRootElem->Attribute("Size"), 0);
-
-	apColladaImageVec->clear();
-	apColladaImageVec->resize(lSize);
+static bool ReadNodeChildren(Common::SeekableReadStream *apStream, cColladaNode *apParentNode, cColladaScene *apColladaScene) {
+	uint32 lChildren;
+	if (!ReadCount(apStream, 1, lChildren))
+		return false;
 
-	int lCount = 0;
-	TiXmlElement *pImageElem = pImageRootElem->FirstChildElement();
-	for (; pImageElem != NULL; pImageElem = pImageElem->NextSiblingElement(), ++lCount) {
-		cColladaImage *pImage = &(*apColladaImageVec)[lCount];
+	for (uint32 i = 0; i < lChildren; ++i) {
+		cColladaNode *pNode = apParentNode->CreateChild();
+		apColladaScene->mlstNodes.push_back(pNode);
+
+		pNode->msId = apStream->readString();
+		pNode->msName = apStream->readString();
+		pNode->msType = apStream->readString();
+		pNode->msSource = apStream->readString();
+		pNode->mbSourceIsFile = apStream->readByte() != 0;
+		pNode->m_mtxTransform = ReadMatrix(apStream);
+		pNode->m_mtxWorldTransform = ReadMatrix(apStream);
+		pNode->mvScale = ReadVector3f(apStream);
+		pNode->mlCount = apStream->readSint32LE();
+
+		uint32 lTransforms;
+		if (!ReadCount(apStream, 1, lTransforms))
+			return false;
+		for (uint32 j = 0; j < lTransforms; ++j) {
+			pNode->mlstTransforms.push_back(cColladaTransform());
+			cColladaTransform &Transform = pNode->mlstTransforms.back();
+
+			Transform.msSid = apStream->readString();
+			Transform.msType = apStream->readString();
+			if (!ReadFloatVec(apStream, Transform.mvValues))
+				return false;
+		}
 
-		pImage->msId = pImageElem->Attribute("Id");
-		pImage->msName = pImageElem->Attribute("Name");
-		pImage->msSource = pImageElem->Attribute("Source");
+		if (!ReadNodeChildren(apStream, pNode, apColladaScene))
+			return false;
 	}
-}
-
-//-----------------------------------------------------------------------
 
-static void LoadTextureVec(TiXmlElement *apRootElem, tColladaTextureVec *apColladaTextureVec) {
-	TiXmlElement *pTextureRootElem = apRootElem->FirstChildElement("TextureRoot");
-
-	int lSize = cString::ToInt(pTextureRootElem->Attribute("Size"), 0);
-
-	apColladaTextureVec->clear();
-	apColladaTextureVec->resize(lSize);
-
-	int lCount = 0;
-	TiXmlElement *pTextureElem = pTextureRootElem->FirstChildElement();
-	for (; pTextureElem != NULL; pTextureElem = pTextureElem->NextSiblingElement(), ++lCount) {
-		cColladaTexture *pTexture = &(*apColladaTextureVec)[lCount];
-
-		pTexture->msId = pTextureElem->Attribute("Id");
-		pTexture->msName = pTextureElem->Attribute("Name");
-		pTexture->msImage = pTextureElem->Attribute("Image");
-	}
+	return true;
 }
 
 //-----------------------------------------------------------------------
 
-static void LoadMaterialVec(TiXmlElement *apRootElem, tColladaMaterialVec *apColladaMaterialVec) {
-	TiXmlElement *pMaterialRootElem = apRootElem->FirstChildElement("MaterialRoot");
-
-	int lSize = cString::ToInt(pMaterialRootElem->Attribute("Size"), 0);
-
-	apColladaMaterialVec->clear();
-	apColladaMaterialVec->resize(lSize);
-
-	int lCount = 0;
-	TiXmlElement *pMaterialElem = pMaterialRootElem->FirstChildElement();
-	for (; pMaterialElem != NULL; pMaterialElem = pMaterialElem->NextSiblingElement(), ++lCount) {
-		cColladaMaterial *pMaterial = &(*apColladaMaterialVec)[lCount];
-
-		pMaterial->msId = pMaterialElem->Attribute("Id");
-		pMaterial->msName = pMaterialElem->Attribute("Name");
-		pMaterial->msTexture = pMaterialElem->Attribute("Texture");
-		pMaterial->mDiffuseColor = cString::ToColor(pMaterialElem->Attribute("Color"), cColor(0, 0));
-	}
-}
+bool cMeshLoaderCollada::LoadStructures(Common::SeekableReadStream *apStream,
+										uint32 alSourceSize, uint32 alSourceHash,
+										tColladaImageVec &avColladaImageVec,
+										tColladaTextureVec &avColladaTextureVec,
+										tColladaMaterialVec &avColladaMaterialVec,
+										tColladaLightVec &avColladaLightVec,
+										tColladaGeometryVec &avColladaGeometryVec,
+										tColladaControllerVec &avColladaControllerVec,
+										tColladaAnimationVec &avColladaAnimVec,
+										cColladaScene *apColladaScene) {
+	if (apStream->readUint32BE() != MKTAG('H', 'P', 'L', 'C') ||
+		apStream->readUint32LE() != kColladaCacheVersion ||
+		apStream->readUint32LE() != alSourceSize ||
+		apStream->readUint32LE() != alSourceHash)
+		return false;
 
-//-----------------------------------------------------------------------
+	uint32 lCount;
 
-static void LoadControllerVec(TiXmlElement *apRootElem, tColladaControllerVec *apColladaControllerVec) {
-	TiXmlElement *pControllerRootElem = apRootElem->FirstChildElement("ControllerRoot");
-	if (pControllerRootElem == NULL) {
-		Warning("Could not find root element 'ControllerRoot' for controller!\n");
-		return;
+	/////////////////////////////////////
+	// Images, textures and materials
+	if (!ReadCount(apStream, 3, lCount))
+		return false;
+	avColladaImageVec.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i) {
+		avColladaImageVec[i].msId = apStream->readString();
+		avColladaImageVec[i].msName = apStream->readString();
+		avColladaImageVec[i].msSource = apStream->readString();
 	}
 
-	int lSize1 = cString::ToInt(pControllerRootElem->Attribute("Size"), 0);
-
-	apColladaControllerVec->clear();
-	apColladaControllerVec->resize(lSize1);
-
-	int lCount = 0;
-	TiXmlElement *pControllerElem = pControllerRootElem->FirstChildElement();
-	for (; pControllerElem != NULL; pControllerElem = pControllerElem->NextSiblingElement(), ++lCount) {
-		cColladaController *pController = &(*apColladaControllerVec)[lCount];
-
-		pController->msId = pControllerElem->Attribute("Id");
-		pController->msTarget = pControllerElem->Attribute("Target");
-
-		pController->m_mtxBindShapeMatrix = cString::ToMatrixf(pControllerElem->Attribute("BindShapeMatrix"), cMatrixf::Identity);
-
-		pController->mlJointPairIdx = cString::ToInt(pControllerElem->Attribute("JointPairIdx"), 0);
-		pController->mlWeightPairIdx = cString::ToInt(pControllerElem->Attribute("WeightPairIdx"), 0);
-
-		////////////////////////////
-		// Joints
-		{
-			TiXmlElement *pJointsElem = pControllerElem->FirstChildElement("Joints");
-			int lSize = cString::ToInt(pJointsElem->Attribute("Size"), 0);
-			TiXmlText *pJointsText = pJointsElem->FirstChild()->ToText();
-
-			tString sData = pJointsText->Value();
-			tString sSepp = " ";
-			pController->mvJoints.reserve(lSize);
-			cString::GetStringVec(sData, pController->mvJoints, &sSepp);
-		}
-		////////////////////////////
-		// Weights
-		{
-			TiXmlElement *pWeightsElem = pControllerElem->FirstChildElement("Weights");
-			int lSize = cString::ToInt(pWeightsElem->Attribute("Size"), 0);
-			TiXmlText *pWeightsText = pWeightsElem->FirstChild()->ToText();
-
-			// tString sData = pWeightsText->Value();
-			// tString sSepp = " "; pController->mvWeights.reserve(lSize);
-			// cString::GetFloatVec(sData,pController->mvWeights,&sSepp);
-
-			pController->mvWeights.resize(lSize);
-			cString::FloatStringToArray(&pController->mvWeights[0], pWeightsText->Value(), lSize);
-		}
-		////////////////////////////
-		// Matrices
-		{
-			TiXmlElement *pMatricesElem = pControllerElem->FirstChildElement("Matrices");
-			int lSize = cString::ToInt(pMatricesElem->Attribute("Size"), 0);
-			TiXmlText *pMatricesText = pMatricesElem->FirstChild()->ToText();
-
-			// tString sData = pMatricesText->Value();
-			// tString sSepp = " ";
-			// cString::GetFloatVec(sData,vRawData,&sSepp);
-			tFloatVec vRawData;
-			vRawData.resize(lSize * 16);
-			cString::FloatStringToArray(&vRawData[0], pMatricesText->Value(), lSize * 16);
-
-			float *pData = &vRawData[0];
-			pController->mvMatrices.reserve(lSize);
-			for (int i = 0; i < lSize; ++i) {
-				pController->mvMatrices.push_back(
-					cMatrixf(pData[0], pData[1], pData[2], pData[3],
-							 pData[4], pData[5], pData[6], pData[7],
-							 pData[8], pData[9], pData[10], pData[11],
-							 pData[12], pData[13], pData[14], pData[15]));
-				pData += 16;
-			}
-		}
-		////////////////////////////
-		// Pairs
-		{
-			TiXmlElement *pPairVecElem = pControllerElem->FirstChildElement("PairVec");
-			int lSize = cString::ToInt(pPairVecElem->Attribute("Size"), 0);
-
-			/////////////////////////////////////////
-			// Get number of connections per pair
-			TiXmlElement *pPairNumElem = pPairVecElem->FirstChildElement("PairNum");
-			TiXmlText *pPairNumText = pPairNumElem->FirstChild()->ToText();
-
-			tUIntVec vPairNum;
-			vPairNum.resize(lSize);
-			// tString sData = pPairNumText->Value();
-			// tString sSepp = " ";
-			// cString::GetIntVec(sData,vPairNum,&sSepp);
-			cString::UIntStringToArray(&vPairNum[0], pPairNumText->Value(), lSize);
-
-			/////////////////////////////////////////
-			// Get pairs
-			TiXmlElement *pPairsElem = pPairVecElem->FirstChildElement("Pairs");
-			int lPairSize = cString::ToInt(pPairsElem->Attribute("Size"), 0);
-			TiXmlText *pPairsText = pPairsElem->FirstChild()->ToText();
-
-			tUIntVec vPairs;
-			vPairs.resize(lPairSize * 2);
-			// sData = pPairsText->Value();
-			// cString::GetIntVec(sData,vPairs,&sSepp);
-			cString::UIntStringToArray(&vPairs[0], pPairsText->Value(), lPairSize * 2);
-
-			pController->mvPairs.resize(lSize);
-
-			int lPairCount = 0;
-			for (int i = 0; i < lSize; ++i) {
-				for (unsigned int j = 0; j < vPairNum[i]; ++j) {
-					pController->mvPairs[i].push_back(
-						cColladaJointPair(vPairs[lPairCount], vPairs[lPairCount + 1]));
-					lPairCount += 2;
-				}
-			}
-		}
+	if (!ReadCount(apStream, 3, lCount))
+		return false;
+	avColladaTextureVec.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i) {
+		avColladaTextureVec[i].msId = apStream->readString();
+		avColladaTextureVec[i].msName = apStream->readString();
+		avColladaTextureVec[i].msImage = apStream->readString();
 	}
-}
-//-----------------------------------------------------------------------
-
-static void LoadLightVec(TiXmlElement *apRootElem, tColladaLightVec *apColladaLightVec) {
-	TiXmlElement *pLightRootElem = apRootElem->FirstChildElement("LightRoot");
 
-	int lSize = cString::ToInt(pLightRootElem->Attribute("Size"), 0);
-
-	apColladaLightVec->clear();
-	apColladaLightVec->resize(lSize);
-
-	int lCount = 0;
-	TiXmlElement *pLightElem = pLightRootElem->FirstChildElement();
-	for (; pLightElem != NULL; pLightElem = pLightElem->NextSiblingElement(), ++lCount) {
-		cColladaLight *pLight = &(*apColladaLightVec)[lCount];
-
-		pLight->msId = pLightElem->Attribute("Id");
-		pLight->msName = pLightElem->Attribute("Name");
-		pLight->msType = pLightElem->Attribute("Type");
-		pLight->mfAngle = cString::ToFloat(pLightElem->Attribute("Angle"), 0);
-		pLight->mDiffuseColor = cString::ToColor(pLightElem->Attribute("Color"), cColor(0, 0));
+	if (!ReadCount(apStream, 3 + 16, lCount))
+		return false;
+	avColladaMaterialVec.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i) {
+		avColladaMaterialVec[i].msId = apStream->readString();
+		avColladaMaterialVec[i].msName = apStream->readString();
+		avColladaMaterialVec[i].msTexture = apStream->readString();
+		avColladaMaterialVec[i].mDiffuseColor = ReadColor(apStream);
 	}
-}
 
-//-----------------------------------------------------------------------
-
-static void LoadAnimationVec(TiXmlElement *apRootElem, tColladaAnimationVec *apColladaAnimationVec) {
-	TiXmlElement *pAnimationRootElem = apRootElem->FirstChildElement("AnimationRoot");
-	if (pAnimationRootElem == NULL) {
-		Warning("Could not find root element 'AnimationRoot' for animation!\n");
-		return;
+	/////////////////////////////////////
+	// Lights
+	if (!ReadCount(apStream, 3 + 16 + 4, lCount))
+		return false;
+	avColladaLightVec.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i) {
+		avColladaLightVec[i].msId = apStream->readString();
+		avColladaLightVec[i].msName = apStream->readString();
+		avColladaLightVec[i].msType = apStream->readString();
+		avColladaLightVec[i].mDiffuseColor = ReadColor(apStream);
+		avColladaLightVec[i].mfAngle = apStream->readFloatLE();
 	}
 
-	int lSize1 = cString::ToInt(pAnimationRootElem->Attribute("Size"), 0);
-
-	apColladaAnimationVec->clear();
-	apColladaAnimationVec->resize(lSize1);
-
-	int lCount = 0;
-	TiXmlElement *pAnimationElem = pAnimationRootElem->FirstChildElement();
-	for (; pAnimationElem != NULL; pAnimationElem = pAnimationElem->NextSiblingElement(), ++lCount) {
-		cColladaAnimation *pAnimation = &(*apColladaAnimationVec)[lCount];
-
-		pAnimation->msId = pAnimationElem->Attribute("Id");
-		pAnimation->msTargetNode = pAnimationElem->Attribute("TargetNode");
-
-		/////////////////////////////////////
-		// Channels
-		{
-			TiXmlElement *pChannelVecElem = pAnimationElem->FirstChildElement("ChannelVec");
-			int lSize = cString::ToInt(pChannelVecElem->Attribute("Size"), 0);
-			pAnimation->mvChannels.resize(lSize);
-
-			int idx = 0;
-			TiXmlElement *pChannelElem = pChannelVecElem->FirstChildElement("Channel");
-			for (; pChannelElem != NULL; pChannelElem = pChannelElem->NextSiblingElement("Channel"), ++idx) {
-				cColladaChannel *pChannel = &pAnimation->mvChannels[idx];
-
-				pChannel->msId = pChannelElem->Attribute("Id");
-				pChannel->msTarget = pChannelElem->Attribute("Target");
-				pChannel->msSource = pChannelElem->Attribute("Source");
-			}
+	/////////////////////////////////////
+	// Geometries
+	if (!ReadCount(apStream, 3, lCount))
+		return false;
+	avColladaGeometryVec.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i) {
+		cColladaGeometry &Geom = avColladaGeometryVec[i];
+
+		Geom.msId = apStream->readString();
+		Geom.msName = apStream->readString();
+		Geom.msMaterial = apStream->readString();
+
+		uint32 lVertices;
+		if (!ReadCount(apStream, 4 * 12 + 16, lVertices))
+			return false;
+		Geom.mvVertexVec.resize(lVertices);
+		for (uint32 j = 0; j < lVertices; ++j) {
+			cVertex &Vtx = Geom.mvVertexVec[j];
+			Vtx.pos = ReadVector3f(apStream);
+			Vtx.tex = ReadVector3f(apStream);
+			Vtx.tan = ReadVector3f(apStream);
+			Vtx.norm = ReadVector3f(apStream);
+			Vtx.col = ReadColor(apStream);
 		}
 
-		/////////////////////////////////////
-		// Samplers
-		{
-			TiXmlElement *pSamplerVecElem = pAnimationElem->FirstChildElement("SamplerVec");
-			int lSize = cString::ToInt(pSamplerVecElem->Attribute("Size"), 0);
-			pAnimation->mvSamplers.resize(lSize);
-
-			int idx = 0;
-			TiXmlElement *pSamplerElem = pSamplerVecElem->FirstChildElement("Sampler");
-			for (; pSamplerElem != NULL; pSamplerElem = pSamplerElem->NextSiblingElement("Sampler"), ++idx) {
-				cColladaSampler *pSampler = &pAnimation->mvSamplers[idx];
-
-				pSampler->msId = pSamplerElem->Attribute("Id");
-				pSampler->msTarget = pSamplerElem->Attribute("Target");
-				pSampler->msTimeArray = pSamplerElem->Attribute("TimeArray");
-				pSampler->msValueArray = pSamplerElem->Attribute("ValueArray");
+		uint32 lIndices;
+		if (!ReadCount(apStream, 4, lIndices))
+			return false;
+		Geom.mvIndexVec.resize(lIndices);
+		for (uint32 j = 0; j < lIndices; ++j)
+			Geom.mvIndexVec[j] = apStream->readUint32LE();
+
+		if (!ReadFloatVec(apStream, Geom.mvTangents))
+			return false;
+
+		uint32 lExtraLists;
+		if (!ReadCount(apStream, 4, lExtraLists))
+			return false;
+		Geom.mvExtraVtxVec.resize(lExtraLists);
+		for (uint32 j = 0; j < lExtraLists; ++j) {
+			uint32 lExtra;
+			if (!ReadCount(apStream, 16, lExtra))
+				return false;
+			for (uint32 k = 0; k < lExtra; ++k) {
+				int lVtx = apStream->readSint32LE();
+				int lNorm = apStream->readSint32LE();
+				int lTex = apStream->readSint32LE();
+				int lNewVtx = apStream->readSint32LE();
+				Geom.mvExtraVtxVec[j].push_back(cColladaExtraVtx(lVtx, lNorm, lTex, lNewVtx));
 			}
 		}
+	}
 
-		/////////////////////////////////////
-		// Sources
-		{
-			TiXmlElement *pSourceVecElem = pAnimationElem->FirstChildElement("SourceVec");
-			int lSize = cString::ToInt(pSourceVecElem->Attribute("Size"), 0);
-			pAnimation->mvSources.resize(lSize);
-
-			int idx = 0;
-			TiXmlElement *pSourceElem = pSourceVecElem->FirstChildElement("Source");
-			for (; pSourceElem != NULL; pSourceElem = pSourceElem->NextSiblingElement("Source"), ++idx) {
-				cColladaAnimSource *pSource = &pAnimation->mvSources[idx];
-
-				pSource->msId = pSourceElem->Attribute("Id");
-				tString sData = pSourceElem->Attribute("Values");
-				tString sSepp = " ";
-				pSource->mvValues.reserve(3);
-
-				cString::GetFloatVec(sData, pSource->mvValues, &sSepp);
+	/////////////////////////////////////
+	// Controllers
+	if (!ReadCount(apStream, 2 + 64 + 8, lCount))
+		return false;
+	avColladaControllerVec.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i) {
+		cColladaController &Ctrl = avColladaControllerVec[i];
+
+		Ctrl.msTarget = apStream->readString();
+		Ctrl.msId = apStream->readString();
+		Ctrl.m_mtxBindShapeMatrix = ReadMatrix(apStream);
+		Ctrl.mlJointPairIdx = apStream->readSint32LE();
+		Ctrl.mlWeightPairIdx = apStream->readSint32LE();
+
+		uint32 lJoints;
+		if (!ReadCount(apStream, 1, lJoints))
+			return false;
+		Ctrl.mvJoints.resize(lJoints);
+		for (uint32 j = 0; j < lJoints; ++j)
+			Ctrl.mvJoints[j] = apStream->readString();
+
+		if (!ReadFloatVec(apStream, Ctrl.mvWeights))
+			return false;
+
+		uint32 lMatrices;
+		if (!ReadCount(apStream, 64, lMatrices))
+			return false;
+		Ctrl.mvMatrices.resize(lMatrices);
+		for (uint32 j = 0; j < lMatrices; ++j)
+			Ctrl.mvMatrices[j] = ReadMatrix(apStream);
+
+		uint32 lPairLists;
+		if (!ReadCount(apStream, 4, lPairLists))
+			return false;
+		Ctrl.mvPairs.resize(lPairLists);
+		for (uint32 j = 0; j < lPairLists; ++j) {
+			uint32 lPairs;
+			if (!ReadCount(apStream, 8, lPairs))
+				return false;
+			for (uint32 k = 0; k < lPairs; ++k) {
+				int lJoint = apStream->readSint32LE();
+				int lWeight = apStream->readSint32LE();
+				Ctrl.mvPairs[j].push_back(cColladaJointPair(lJoint, lWeight));
 			}
 		}
 	}
-}
-
-//-----------------------------------------------------------------------
-
-static void LoadGeometryVec(TiXmlElement *apRootElem, tColladaGeometryVec *apColladaGeometryVec) {
-	TiXmlElement *pGeometryRootElem = apRootElem->FirstChildElement("GeometryRoot");
-
-	int lSize1 = cString::ToInt(pGeometryRootElem->Attribute("Size"), 0);
-
-	apColladaGeometryVec->clear();
-	apColladaGeometryVec->resize(lSize1);
-
-	int lCount = 0;
-	TiXmlElement *pGeometryElem = pGeometryRootElem->FirstChildElement();
-	for (; pGeometryElem != NULL; pGeometryElem = pGeometryElem->NextSiblingElement(), ++lCount) {
-		cColladaGeometry *pGeometry = &(*apColladaGeometryVec)[lCount];
-
-		pGeometry->msId = pGeometryElem->Attribute("Id");
-		pGeometry->msName = pGeometryElem->Attribute("Name");
-		pGeometry->msMaterial = pGeometryElem->Attribute("Material");
-
-		/////////////////////////////////
-		// Index Vec
-		{
-			TiXmlElement *pIndexVecElem = pGeometryElem->FirstChildElement("IndexVec");
-			int lSize = cString::ToInt(pIndexVecElem->Attribute("Size"), 0);
 
-			if (lSize > 0) {
-				TiXmlElement *pIndicesDataElem = pIndexVecElem->FirstChildElement("Indices");
-				TiXmlText *pVecText = pIndicesDataElem->FirstChild()->ToText();
-
-				pGeometry->mvIndexVec.resize(lSize);
-
-				cString::UIntStringToArray(&pGeometry->mvIndexVec[0], pVecText->Value(), lSize);
-
-				// tString sData = pVecText->Value();
-				// tString sSepp = " ";
-				// cString::GetUIntVec(sData,pGeometry->mvIndexVec,&sSepp);
-			}
+	/////////////////////////////////////
+	// Animations
+	if (!ReadCount(apStream, 2, lCount))
+		return false;
+	avColladaAnimVec.resize(lCount);
+	for (uint32 i = 0; i < lCount; ++i) {
+		cColladaAnimation &Anim = avColladaAnimVec[i];
+
+		Anim.msId = apStream->readString();
+		Anim.msTargetNode = apStream->readString();
+
+		uint32 lChannels;
+		if (!ReadCount(apStream, 3, lChannels))
+			return false;
+		Anim.mvChannels.resize(lChannels);
+		for (uint32 j = 0; j < lChannels; ++j) {
+			Anim.mvChannels[j].msId = apStream->readString();
+			Anim.mvChannels[j].msTarget = apStream->readString();
+			Anim.mvChannels[j].msSource = apStream->readString();
 		}
 
-		/////////////////////////////////
-		// Vertex vec
-		{
-			TiXmlElement *pVertexVecElem = pGeometryElem->FirstChildElement("VertexVec");
-			int lSize = cString::ToInt(pVertexVecElem->Attribute("Size"), 0);
-
-			if (lSize > 0) {
-				pGeometry->mvVertexVec.resize(lSize);
-
-				tFloatVec vRawData;
-				vRawData.resize(lSize * 3);
-
-				/////////////////////////////////
-				// Positions
-				{
-					TiXmlElement *pDataElem = pVertexVecElem->FirstChildElement("Positions");
-					TiXmlText *pVecText = pDataElem->FirstChild()->ToText();
-
-					// tString sData = pVecText->Value();
-					// tString sSepp = " ";
-					// tFloatVec vRawData; vRawData.reserve(lSize * 3);
-					// cString::GetFloatVec(sData,vRawData,&sSepp);
-
-					cString::FloatStringToArray(&vRawData[0], pVecText->Value(), lSize * 3);
-
-					float *pData = &vRawData[0];
-					for (int i = 0; i < lSize; ++i) {
-						cVector3f &vPos = pGeometry->mvVertexVec[i].pos;
-						vPos.x = pData[0];
-						vPos.y = pData[1];
-						vPos.z = pData[2];
-						pData += 3;
-					}
-				}
-
-				/////////////////////////////////
-				// Normals
-				{
-					TiXmlElement *pDataElem = pVertexVecElem->FirstChildElement("Normals");
-					TiXmlText *pVecText = pDataElem->FirstChild()->ToText();
-
-					// tString sData = pVecText->Value();
-					// tString sSepp = " ";
-					// tFloatVec vRawData; vRawData.reserve(lSize * 3);
-					// cString::GetFloatVec(sData,vRawData,&sSepp);
-
-					cString::FloatStringToArray(&vRawData[0], pVecText->Value(), lSize * 3);
-
-					float *pData = &vRawData[0];
-					for (int i = 0; i < lSize; ++i) {
-						cVector3f &vPos = pGeometry->mvVertexVec[i].norm;
-						vPos.x = pData[0];
-						vPos.y = pData[1];
-						vPos.z = pData[2];
-						pData += 3;
-					}
-				}
-
-				/////////////////////////////////
-				// UVs
-				{
-					TiXmlElement *pDataElem = pVertexVecElem->FirstChildElement("UV");
-					TiXmlText *pVecText = pDataElem->FirstChild()->ToText();
-
-					// tString sData = pVecText->Value();
-					// tString sSepp = " ";
-					// tFloatVec vRawData; vRawData.reserve(lSize * 3);
-					// cString::GetFloatVec(sData,vRawData,&sSepp);
-
-					cString::FloatStringToArray(&vRawData[0], pVecText->Value(), lSize * 3);
-
-					float *pData = &vRawData[0];
-					for (int i = 0; i < lSize; ++i) {
-						cVector3f &vPos = pGeometry->mvVertexVec[i].tex;
-						vPos.x = pData[0];
-						vPos.y = pData[1];
-						vPos.z = pData[2];
-						pData += 3;
-					}
-				}
-
-				/////////////////////////////////
-				// Tangents
-				{
-					TiXmlElement *pDataElem = pVertexVecElem->FirstChildElement("Tangents");
-					TiXmlText *pVecText = pDataElem->FirstChild()->ToText();
-
-					// tString sData = pVecText->Value();
-					// tString sSepp = " ";
-					// tFloatVec vRawData; vRawData.reserve(lSize * 3);
-					// cString::GetFloatVec(sData,vRawData,&sSepp);
-
-					pGeometry->mvTangents.resize(lSize * 4);
-					cString::FloatStringToArray(&pGeometry->mvTangents[0], pVecText->Value(), lSize * 4);
-				}
-			}
+		uint32 lSamplers;
+		if (!ReadCount(apStream, 4, lSamplers))
+			return false;
+		Anim.mvSamplers.resize(lSamplers);
+		for (uint32 j = 0; j < lSamplers; ++j) {
+			Anim.mvSamplers[j].msId = apStream->readString();
+			Anim.mvSamplers[j].msTimeArray = apStream->readString();
+			Anim.mvSamplers[j].msValueArray = apStream->readString();
+			Anim.mvSamplers[j].msTarget = apStream->readString();
 		}
 
-		/////////////////////////////////
-		// Extra vertex vec
-		{
-			TiXmlElement *pVertexVecElem = pGeometryElem->FirstChildElement("ExtraVertexVec");
-			int lSize = cString::ToInt(pVertexVecElem->Attribute("Size"), 0);
-
-			if (lSize > 0) {
-				pGeometry->mvExtraVtxVec.resize(lSize);
-				tUIntVec mvExtraNum;
-				mvExtraNum.resize(lSize);
-				tUIntVec mvExtraVtx;
-
-				//////////////////////////////////////////////
-				// Extra num
-				{
-					TiXmlElement *pExtraNumElem = pVertexVecElem->FirstChildElement("ExtraNum");
-					TiXmlText *pExtraNumText = pExtraNumElem->FirstChild()->ToText();
-
-					cString::UIntStringToArray(&mvExtraNum[0], pExtraNumText->Value(), lSize);
-				}
-
-				//////////////////////////////////////////////
-				// Extra vertex
-				{
-					TiXmlElement *pExtraVertexElem = pVertexVecElem->FirstChildElement("ExtraVertex");
-					TiXmlText *pExtraVertexText = pExtraVertexElem->FirstChild()->ToText();
-					int lExtraVtxSize = cString::ToInt(pExtraVertexElem->Attribute("Size"), 0);
-					mvExtraVtx.resize(lExtraVtxSize * 4);
-
-					cString::UIntStringToArray(&mvExtraVtx[0], pExtraVertexText->Value(), lExtraVtxSize * 4);
-				}
-
-				unsigned int *pData = &mvExtraVtx[0];
-				for (int idx = 0; idx < lSize; ++idx) {
-					tColladaExtraVtxList *pList = &pGeometry->mvExtraVtxVec[idx];
-
-					for (unsigned int j = 0; j < mvExtraNum[idx]; ++j) {
-						pList->push_back(cColladaExtraVtx(pData[0], pData[1], pData[2], pData[3]));
-						pData += 4;
-					}
-				}
-			}
+		uint32 lSources;
+		if (!ReadCount(apStream, 1 + 4, lSources))
+			return false;
+		Anim.mvSources.resize(lSources);
+		for (uint32 j = 0; j < lSources; ++j) {
+			Anim.mvSources[j].msId = apStream->readString();
+			if (!ReadFloatVec(apStream, Anim.mvSources[j].mvValues))
+				return false;
 		}
 	}
-}
 
-//-----------------------------------------------------------------------
-
-static void LoadIterativeNode(TiXmlElement *apNodeElem, cColladaNode *apParentNode, cColladaScene *apColladaScene) {
-	cColladaNode *pNode = apParentNode->CreateChild();
-	apColladaScene->mlstNodes.push_back(pNode);
-
-	pNode->msId = apNodeElem->Attribute("Id");
-	pNode->msName = apNodeElem->Attribute("Name");
-	pNode->msType = apNodeElem->Attribute("Type");
-
-	pNode->msSource = apNodeElem->Attribute("Source");
-	pNode->mbSourceIsFile = cString::ToBool(apNodeElem->Attribute("SourceIsFile"), false);
-
-	pNode->m_mtxTransform = cString::ToMatrixf(apNodeElem->Attribute("Transform"), cMatrixf::Identity);
-	pNode->m_mtxWorldTransform = cString::ToMatrixf(apNodeElem->Attribute("WorldTransform"), cMatrixf::Identity);
-
-	pNode->mvScale = cString::ToVector3f(apNodeElem->Attribute("Scale"), 1);
-	pNode->mlCount = cString::ToInt(apNodeElem->Attribute("Count"), 1);
-
-	TiXmlElement *pTransformRootElem = apNodeElem->FirstChildElement("TransformRoot");
-	TiXmlElement *pTransformElem = pTransformRootElem->FirstChildElement("Transform");
-	for (; pTransformElem != NULL; pTransformElem = pTransformElem->NextSiblingElement("Transform")) {
-		pNode->mlstTransforms.push_back(cColladaTransform());
-		cColladaTransform &transform = pNode->mlstTransforms.back();
-
-		transform.msSid = pTransformElem->Attribute("Sid");
-		transform.msType = pTransformElem->Attribute("Type");
-
-		tString sData = pTransformElem->Attribute("Values");
-		tString sSepp = " ";
-		cString::GetFloatVec(sData, transform.mvValues, &sSepp);
-	}
+	/////////////////////////////////////
+	// Scene
+	apColladaScene->mfStartTime = apStream->readFloatLE();
+	apColladaScene->mfEndTime = apStream->readFloatLE();
+	apColladaScene->mfDeltaTime = apStream->readFloatLE();
+	if (!ReadNodeChildren(apStream, &apColladaScene->mRoot, apColladaScene))
+		return false;
 
-	TiXmlElement *pChildElem = apNodeElem->FirstChildElement("Node");
-	for (; pChildElem != NULL; pChildElem = pChildElem->NextSiblingElement("Node")) {
-		LoadIterativeNode(pChildElem, pNode, apColladaScene);
-	}
+	return !apStream->err() && !apStream->eos();
 }
 
 //-----------------------------------------------------------------------
 
-static void LoadScene(TiXmlElement *apRootElem, cColladaScene *apColladaScene) {
-	TiXmlElement *pSceneElem = apRootElem->FirstChildElement("Scene");
-
-	// Delete all nodes.
-	apColladaScene->ResetNodes();
-
-	apColladaScene->mfStartTime = cString::ToFloat(pSceneElem->Attribute("StartTime"), 0);
-	apColladaScene->mfEndTime = cString::ToFloat(pSceneElem->Attribute("EndTime"), 0);
-	apColladaScene->mfDeltaTime = cString::ToFloat(pSceneElem->Attribute("DeltaTime"), 0);
-
-	TiXmlElement *pSceneRootElem = pSceneElem->FirstChildElement("Root");
-	TiXmlElement *pNodeElem = pSceneRootElem->FirstChildElement("Node");
-	for (; pNodeElem != NULL; pNodeElem = pNodeElem->NextSiblingElement("Node")) {
-		LoadIterativeNode(pNodeElem, &apColladaScene->mRoot, apColladaScene);
-	}
-}
-
-//-----------------------------------------------------------------------
 } // namespace hpl
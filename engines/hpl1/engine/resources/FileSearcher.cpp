@@ -92,4 +92,19 @@ tString cFileSearcher::GetFilePath(tString asName) {
 
 //-----------------------------------------------------------------------
 
+void cFileSearcher::GetFilePaths(const tString &asExt, tStringList &alstPaths) {
+	tString sLastName = "";
+	for (tFilePathMapIt it = m_mapFiles.begin(); it != m_mapFiles.end(); ++it) {
+		// A name found in several directories resolves to the first one
+		if (it->first == sLastName)
+			continue;
+		sLastName = it->first;
+
+		if (cString::GetFileExt(it->first) == asExt)
+			alstPaths.push_back(it->second);
+	}
+}
+
+//-----------------------------------------------------------------------
+
 } // namespace hpl
@@ -64,6 +64,13 @@ public:
 	 */
 	tString GetFilePath(tString asName);
 
+	/**
+	 * Lists the paths of all files with the extension, as GetFilePath() would return them.
+	 * \param asExt Lower case extension, without the dot.
+	 * \param alstPaths List the paths are added to.
+	 */
+	void GetFilePaths(const tString &asExt, tStringList &alstPaths);
+
 private:
 	tFilePathMap m_mapFiles;
 	tStringSet m_setLoadedDirs;
@@ -76,6 +76,12 @@ public:
 
 	virtual void AddSupportedTypes(tStringVec *avFileTypes) = 0;
 
+	/**
+	 * Processes the file and stores the result in the loader's cache, if it has one.
+	 * \return false if the file could not be processed.
+	 */
+	virtual bool BuildCache(const tString &asFile) { return true; }
+
 	static void SetRestricStaticLightToSector(bool abX) { mbRestricStaticLightToSector = abX; }
 	static void SetUseFastMaterial(bool abX) { mbUseFastMaterial = abX; }
 
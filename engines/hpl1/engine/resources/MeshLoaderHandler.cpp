@@ -27,6 +27,7 @@
 
 #include "hpl1/engine/resources/MeshLoaderHandler.h"
 
+#include "hpl1/engine/resources/FileSearcher.h"
 #include "hpl1/engine/resources/MeshLoader.h"
 #include "hpl1/engine/resources/Resources.h"
 #include "hpl1/engine/scene/Scene.h"
@@ -140,6 +141,30 @@ cAnimation *cMeshLoaderHandler::LoadAnimation(const tString &asFile) {
 
 //-----------------------------------------------------------------------
 
+void cMeshLoaderHandler::BuildCache() {
+	for (size_t i = 0; i < mvSupportedTypes.size(); ++i) {
+		tString sType = cString::ToLowerCase(mvSupportedTypes[i]);
+
+		tStringList lstFiles;
+		mpResources->GetFileSearcher()->GetFilePaths(sType, lstFiles);
+
+		tMeshLoaderListIt it = mlstLoaders.begin();
+		for (; it != mlstLoaders.end(); it++) {
+			iMeshLoader *pLoader = *it;
+
+			if (pLoader->IsSupported(sType)) {
+				for (tStringListIt fileIt = lstFiles.begin(); fileIt != lstFiles.end(); ++fileIt) {
+					if (pLoader->BuildCache(*fileIt) == false)
+						Warning("Couldn't build cache for '%s'\n", fileIt->c_str());
+				}
+				break;
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------
+
 void cMeshLoaderHandler::AddLoader(iMeshLoader *apLoader) {
 	mlstLoaders.push_back(apLoader);
 
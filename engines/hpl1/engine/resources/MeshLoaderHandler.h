@@ -61,6 +61,11 @@ public:
 
 	void AddLoader(iMeshLoader *apLoader);
 
+	/**
+	 * Fills the loader caches for every mesh file found in the resource directories.
+	 */
+	void BuildCache();
+
 	tStringVec *GetSupportedTypes() { return &mvSupportedTypes; }
 
 private:
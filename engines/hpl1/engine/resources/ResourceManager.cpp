@@ -39,6 +39,8 @@
 namespace hpl {
 
 int iResourceManager::mlTabCount = 0;
+Common::Array<iResourceManager *> iResourceManager::mvLoadStack;
+unsigned long iResourceManager::mlLoadMark = 0;
 
 //////////////////////////////////////////////////////////////////////////
 // CONSTRUCTORS
@@ -53,6 +55,8 @@ iResourceManager::iResourceManager(cFileSearcher *apFileSearcher,
 	mpLowLevelResources = apLowLevelResources;
 	mpLowLevelSystem = apLowLevelSystem;
 	mlHandleCount = 0;
+	mlLoadTime = 0;
+	mlLoadCount = 0;
 }
 
 //-----------------------------------------------------------------------
@@ -174,6 +178,13 @@ void iResourceManager::DestroyAll() {
 
 //-----------------------------------------------------------------------
 
+void iResourceManager::ResetLoadTime() {
+	mlLoadTime = 0;
+	mlLoadCount = 0;
+}
+
+//-----------------------------------------------------------------------
+
 //////////////////////////////////////////////////////////////////////////
 // PROTECTED METHODS
 //////////////////////////////////////////////////////////////////////////
@@ -185,12 +196,26 @@ void iResourceManager::BeginLoad(const tString &asFile) {
 
 	// Log("Begin resource: %s\n",asFile.c_str());
 
+	// Time up to here belongs to the load this one is nested in.
+	ChargeLoadTime();
+	mvLoadStack.push_back(this);
+	mlLoadCount++;
+
 	mlTabCount++;
 }
 
 //-----------------------------------------------------------------------
 
 void iResourceManager::EndLoad() {
+	ChargeLoadTime();
+	// Also drops nested loads that returned without calling EndLoad()
+	for (int i = (int)mvLoadStack.size() - 1; i >= 0; --i) {
+		if (mvLoadStack[i] == this) {
+			mvLoadStack.resize(i);
+			break;
+		}
+	}
+
 	mlTabCount--;
 }
 
@@ -252,4 +277,13 @@ unsigned long iResourceManager::GetHandle() {
 
 //-----------------------------------------------------------------------
 
+void iResourceManager::ChargeLoadTime() {
+	unsigned long lTime = GetApplicationTime();
+	if (!mvLoadStack.empty())
+		mvLoadStack.back()->mlLoadTime += lTime - mlLoadMark;
+	mlLoadMark = lTime;
+}
+
+//-----------------------------------------------------------------------
+
 } // namespace hpl
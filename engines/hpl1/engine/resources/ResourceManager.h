@@ -71,6 +71,14 @@ public:
 
 	virtual void Update(float afTimeStep) {}
 
+	/**
+	 * Time in ms spent loading resources of this manager since the last reset. Loads done
+	 * by other managers while one of ours is in progress are not counted.
+	 */
+	unsigned long GetLoadTime() const { return mlLoadTime; }
+	int GetLoadCount() const { return mlLoadCount; }
+	void ResetLoadTime();
+
 protected:
 	unsigned long mlHandleCount;
 	tResourceNameMap m_mapNameResources;
@@ -99,6 +107,15 @@ protected:
 
 	tString GetTabs();
 	static int mlTabCount;
+
+private:
+	void ChargeLoadTime();
+
+	unsigned long mlLoadTime;
+	int mlLoadCount;
+
+	static Common::Array<iResourceManager *> mvLoadStack;
+	static unsigned long mlLoadMark;
 };
 
 } // namespace hpl
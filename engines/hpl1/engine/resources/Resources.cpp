@@ -26,6 +26,7 @@
  */
 
 #include "hpl1/engine/resources/Resources.h"
+#include "hpl1/debug.h"
 
 #include "hpl1/engine/resources/AnimationManager.h"
 #include "hpl1/engine/resources/ConfigFile.h"
@@ -140,7 +141,7 @@ void cResources::Init(cGraphics *apGraphics, cSystem *apSystem, cSound *apSound,
 	mpParticleManager = hplNew(cParticleManager, (apGraphics, this));
 	mlstManagers.push_back(mpParticleManager);
 	mpSoundManager = hplNew(cSoundManager, (apSound, this));
-	mlstManagers.push_back(mpParticleManager);
+	mlstManagers.push_back(mpSoundManager);
 	mpFontManager = hplNew(cFontManager, (apGraphics, apGui, this));
 	mlstManagers.push_back(mpFontManager);
 	mpScriptManager = hplNew(cScriptManager, (apSystem, this));
@@ -181,6 +182,48 @@ void cResources::Update(float afTimeStep) {
 
 //-----------------------------------------------------------------------
 
+void cResources::ResetLoadTimes() {
+	for (tResourceManagerListIt it = mlstManagers.begin(); it != mlstManagers.end(); ++it)
+		(*it)->ResetLoadTime();
+}
+
+void cResources::LogLoadTimes(const tString &asName, unsigned long alTotalTime) {
+	const struct {
+		const char *name;
+		iResourceManager *manager;
+	} vManagers[] = {
+		{"images", mpImageManager},
+		{"gpu programs", mpGpuProgramManager},
+		{"tile sets", mpTileSetManager},
+		{"image entities", mpImageEntityManager},
+		{"particles", mpParticleManager},
+		{"sounds", mpSoundManager},
+		{"fonts", mpFontManager},
+		{"scripts", mpScriptManager},
+		{"textures", mpTextureManager},
+		{"materials", mpMaterialManager},
+		{"meshes", mpMeshManager},
+		{"sound entities", mpSoundEntityManager},
+		{"animations", mpAnimationManager},
+		{"videos", mpVideoManager},
+	};
+
+	Hpl1::logInfo(Hpl1::kDebugResourceLoading, "loaded '%s' in %lu ms\n", asName.c_str(), alTotalTime);
+
+	unsigned long lResourceTime = 0;
+	for (const auto &m : vManagers) {
+		if (m.manager->GetLoadCount() == 0)
+			continue;
+		Hpl1::logInfo(Hpl1::kDebugResourceLoading, "  %-15s %6lu ms, %d requests\n", m.name,
+					  m.manager->GetLoadTime(), m.manager->GetLoadCount());
+		lResourceTime += m.manager->GetLoadTime();
+	}
+	if (alTotalTime > lResourceTime)
+		Hpl1::logInfo(Hpl1::kDebugResourceLoading, "  %-15s %6lu ms\n", "other", alTotalTime - lResourceTime);
+}
+
+//-----------------------------------------------------------------------
+
 cFileSearcher *cResources::GetFileSearcher() {
 	return mpFileSearcher;
 }
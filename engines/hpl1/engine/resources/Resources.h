@@ -189,6 +189,18 @@ public:
 
 	bool LoadResourceDirsFile(const tString &asFile);
 
+	/**
+	 * Clears the load times kept by the resource managers.
+	 */
+	void ResetLoadTimes();
+	/**
+	 * Logs how the time spent loading since the last ResetLoadTimes() was split
+	 * between the resource types.
+	 * \param asName what was loaded, used in the log.
+	 * \param alTotalTime total time of the load in ms.
+	 */
+	void LogLoadTimes(const tString &asName, unsigned long alTotalTime);
+
 	cImageManager *GetImageManager() { return mpImageManager; }
 	cGpuProgramManager *GetGpuProgramManager() { return mpGpuProgramManager; }
 	cTileSetManager *GetTileSetManager() { return mpTileSetManager; }
@@ -202,6 +202,7 @@ iTexture *cTextureManager::CreateCubeMap(const tString &asPathName, bool abUseMi
 			if (sPath == "") {
 				tString sNewName = sName + mvCubeSideSuffixes[i];
 				Error("Couldn't find %d-face '%s', for cubemap '%s'\n", i, sNewName.c_str(), sName.c_str());
+				EndLoad();
 				return NULL;
 			}
 
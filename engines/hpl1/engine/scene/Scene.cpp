@@ -364,12 +364,17 @@ cWorld3D *cScene::LoadWorld3D(const tString &asFile, bool abLoadScript, tWorldLo
 		return NULL;
 	}
 
+	unsigned long lStartTime = GetApplicationTime();
+	mpResources->ResetLoadTimes();
+
 	cWorld3D *pWorld = mpResources->GetMeshLoaderHandler()->LoadWorld(asPath, aFlags);
 	if (pWorld == NULL) {
 		Error("Couldn't load world from '%s'\n", asPath.c_str());
 		return NULL;
 	}
 
+	mpResources->LogLoadTimes(asFile, GetApplicationTime() - lStartTime);
+
 	////////////////////////////////////////////////////////////
 	// Load the script
 	iScript *pScript = NULL;
@@ -309,6 +309,7 @@ public:
 											float afMaxHeight);
 
 	cAStarHandler *CreateAStarHandler(cAINodeContainer *apContainer);
+	tAINodeContainerList *GetAINodeContainerList() { return &mlstAINodeContainers; }
 
 	void AddAINode(const tString &asName, const tString &asType, const cVector3f &avPosition);
 	tTempAiNodeList *GetAINodeList(const tString &asType);
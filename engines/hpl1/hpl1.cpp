@@ -30,6 +30,7 @@
 #include "engine/engine.h"
 #include "engines/util.h"
 #include "graphics/palette.h"
+#include "hpl1/console.h"
 #include "hpl1/debug.h"
 #include "hpl1/detection.h"
 #include "hpl1/engine/system/String.h"
@@ -73,6 +74,7 @@ Common::Error Hpl1Engine::run() {
 		delete _gameInit;
 		return Common::kUnknownError; // TODO: better errors
 	};
+	setDebugger(new Console(_gameInit));
 	_gameInit->Run();
 	_gameInit->Exit();
 	delete _gameInit;
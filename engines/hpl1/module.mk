@@ -1,6 +1,7 @@
 MODULE := engines/hpl1
 
 MODULE_OBJS := \
+	console.o \
 	string.o \
 	opengl.o \
 	graphics.o \
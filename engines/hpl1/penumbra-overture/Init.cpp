@@ -249,6 +249,10 @@ bool cInit::Init(tString saveToLoad) {
 	// RESOURCE INIT /////////////////////
 	mpGame->GetResources()->LoadResourceDirsFile("resources.cfg");
 
+	// Process all the models and maps up front, so they load from the cache
+	if (getBoolConfig("build_collada_cache", false))
+		mpGame->GetResources()->GetMeshLoaderHandler()->BuildCache();
+
 	// LANGUAGE ////////////////////////////////
 	mpGame->GetResources()->SetLanguageFile(msLanguageFile);
 
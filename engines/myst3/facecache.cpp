@@ -0,0 +1,203 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "engines/myst3/facecache.h"
+#include "engines/myst3/archive.h"
+#include "engines/myst3/myst3.h"
+
+#include "graphics/surface.h"
+
+namespace Myst3 {
+
+FaceCache::FaceCache(Myst3Engine *vm) :
+		_vm(vm),
+		_useCounter(0) {
+}
+
+FaceCache::~FaceCache() {
+	clear();
+}
+
+void FaceCache::clear() {
+	for (uint i = 0; i < _entries.size(); i++) {
+		freeEntry(_entries[i]);
+	}
+	_entries.clear();
+	_pending.clear();
+}
+
+void FaceCache::freeEntry(Entry &entry) {
+	for (uint i = 0; i < kFaceCount; i++) {
+		if (entry.faces[i]) {
+			entry.faces[i]->free();
+			delete entry.faces[i];
+			entry.faces[i] = nullptr;
+		}
+	}
+}
+
+FaceCache::Entry *FaceCache::findEntry(const Common::String &room, uint16 node) {
+	for (uint i = 0; i < _entries.size(); i++) {
+		if (_entries[i].node == node && _entries[i].room == room) {
+			return &_entries[i];
+		}
+	}
+
+	return nullptr;
+}
+
+FaceCache::Entry &FaceCache::addEntry(const Common::String &room, uint16 node) {
+	if (_entries.size() >= kMaxNodes) {
+		uint oldest = 0;
+		for (uint i = 1; i < _entries.size(); i++) {
+			if (_entries[i].lastUse < _entries[oldest].lastUse) {
+				oldest = i;
+			}
+		}
+
+		freeEntry(_entries[oldest]);
+		_entries.remove_at(oldest);
+	}
+
+	Entry entry;
+	entry.room = room;
+	entry.node = node;
+	entry.lastUse = ++_useCounter;
+	for (uint i = 0; i < kFaceCount; i++) {
+		entry.faces[i] = nullptr;
+	}
+
+	_entries.push_back(entry);
+	return _entries.back();
+}
+
+Graphics::Surface *FaceCache::takeFace(const Common::String &room, uint16 node, uint face) {
+	Entry *entry = findEntry(room, node);
+	if (!entry || face >= kFaceCount) {
+		return nullptr;
+	}
+
+	// The node spot items draw into the face, so it can't stay shared
+	Graphics::Surface *surface = entry->faces[face];
+	entry->faces[face] = nullptr;
+	entry->lastUse = ++_useCounter;
+
+	return surface;
+}
+
+void FaceCache::prefetchNeighbours(const NodePtr &nodeData, const Common::String &room) {
+	_pending.clear();
+
+	if (!nodeData) {
+		return;
+	}
+
+	Common::Array<uint16> neighbours;
+	for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+		const Common::Array<Opcode> &script = nodeData->hotspots[i].script;
+
+		for (uint j = 0; j < script.size(); j++) {
+			const Opcode &opcode = script[j];
+
+			// Negative arguments are variable references, their value
+			// is not known until the script runs
+			switch (opcode.op) {
+			case 135: // chooseNextNode
+				if (opcode.args.size() >= 3) {
+					if (opcode.args[1] > 0)
+						neighbours.push_back(opcode.args[1]);
+					if (opcode.args[2] > 0)
+						neighbours.push_back(opcode.args[2]);
+				}
+				break;
+			case 136: // goToNodeTransition
+			case 137: // goToNodeTrans2
+			case 138: // goToNodeTrans1
+			case 140: // zipToNode
+			case 164: // changeNode
+				if (!opcode.args.empty() && opcode.args[0] > 0)
+					neighbours.push_back(opcode.args[0]);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	uint queuedNodes = 0;
+	for (uint i = 0; i < neighbours.size() && queuedNodes < kMaxNodes - 1; i++) {
+		uint16 node = neighbours[i];
+
+		bool seen = node == nodeData->id;
+		for (uint j = 0; j < i && !seen; j++) {
+			seen = neighbours[j] == node;
+		}
+
+		// Frame nodes are not prefetched
+		if (seen || !_vm->getFileDescription(room, node, 1, Archive::kCubeFace).isValid()) {
+			continue;
+		}
+
+		Entry *entry = findEntry(room, node);
+		if (!entry) {
+			entry = &addEntry(room, node);
+		} else {
+			entry->lastUse = ++_useCounter;
+		}
+
+		for (uint face = 0; face < kFaceCount; face++) {
+			if (!entry->faces[face]) {
+				PendingFace pending;
+				pending.room = room;
+				pending.node = node;
+				pending.face = face;
+				_pending.push_back(pending);
+			}
+		}
+
+		queuedNodes++;
+	}
+}
+
+bool FaceCache::decodeNext() {
+	while (!_pending.empty()) {
+		PendingFace pending = _pending.front();
+		_pending.remove_at(0);
+
+		// The entry may have been dropped to make room for more recent nodes
+		Entry *entry = findEntry(pending.room, pending.node);
+		if (!entry || entry->faces[pending.face]) {
+			continue;
+		}
+
+		ResourceDescription jpegDesc = _vm->getFileDescription(pending.room, pending.node, pending.face + 1, Archive::kCubeFace);
+		if (!jpegDesc.isValid()) {
+			continue;
+		}
+
+		entry->faces[pending.face] = Myst3Engine::decodeJpeg(&jpegDesc);
+		return true;
+	}
+
+	return false;
+}
+
+} // End of namespace Myst3
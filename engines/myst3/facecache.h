@@ -0,0 +1,100 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MYST3_FACECACHE_H
+#define MYST3_FACECACHE_H
+
+#include "common/array.h"
+#include "common/str.h"
+
+#include "engines/myst3/database.h"
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Myst3 {
+
+class Myst3Engine;
+
+/**
+ * Decoded cube faces of the nodes next to the current one
+ *
+ * When a cube node is entered, the nodes its hotspots lead to are queued.
+ * Their faces are then decoded one per frame, so that moving to one of them
+ * only has to upload the textures. Only a few nodes are kept, the least
+ * recently used one is dropped first.
+ */
+class FaceCache {
+public:
+	FaceCache(Myst3Engine *vm);
+	~FaceCache();
+
+	/**
+	 * Hand over a decoded cube face
+	 *
+	 * @return the face, owned by the caller from now on, or nullptr when it is not cached
+	 */
+	Graphics::Surface *takeFace(const Common::String &room, uint16 node, uint face);
+
+	/** Queue the faces of the cube nodes the hotspots of a node lead to */
+	void prefetchNeighbours(const NodePtr &nodeData, const Common::String &room);
+
+	/**
+	 * Decode one of the queued faces
+	 *
+	 * @return false when there was nothing left to decode
+	 */
+	bool decodeNext();
+
+	void clear();
+
+private:
+	static const uint kMaxNodes = 4;
+	static const uint kFaceCount = 6;
+
+	struct Entry {
+		Common::String room;
+		uint16 node;
+		uint32 lastUse;
+		Graphics::Surface *faces[kFaceCount];
+	};
+
+	struct PendingFace {
+		Common::String room;
+		uint16 node;
+		uint face;
+	};
+
+	Myst3Engine *_vm;
+
+	Common::Array<Entry> _entries;
+	Common::Array<PendingFace> _pending;
+	uint32 _useCounter;
+
+	Entry *findEntry(const Common::String &room, uint16 node);
+	Entry &addEntry(const Common::String &room, uint16 node);
+	void freeEntry(Entry &entry);
+};
+
+} // End of namespace Myst3
+
+#endif
@@ -37,6 +37,7 @@
 #include "engines/myst3/console.h"
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/myst3.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/nodeframe.h"
@@ -63,7 +64,7 @@ namespace Myst3 {
 
 Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		Engine(syst), _system(syst), _gameDescription(version),
-		_db(nullptr), _scriptEngine(nullptr),
+		_db(nullptr), _faceCache(nullptr), _scriptEngine(nullptr),
 		_state(nullptr), _node(nullptr), _scene(nullptr), _archiveNode(nullptr),
 		_cursor(nullptr), _inventory(nullptr), _gfx(nullptr), _menu(nullptr),
 		_rnd(nullptr), _sound(nullptr), _ambient(nullptr),
@@ -113,6 +114,7 @@ Myst3Engine::~Myst3Engine() {
 	delete _cursor;
 	delete _scene;
 	delete _archiveNode;
+	delete _faceCache;
 	delete _db;
 	delete _scriptEngine;
 	delete _state;
@@ -163,6 +165,7 @@ Common::Error Myst3Engine::run() {
 	setDebugger(new Console(this));
 	_scriptEngine = new Script(this);
 	_db = new Database(getPlatform(), getGameLanguage(), getGameLocalizationType());
+	_faceCache = new FaceCache(this);
 	_state = new GameState(getPlatform(), _db);
 	_scene = new Scene(this);
 	if (getPlatform() == Common::kPlatformXbox) {
@@ -214,6 +217,9 @@ Common::Error Myst3Engine::run() {
 		}
 
 		drawFrame();
+
+		// Use the rest of the frame to get the nodes around ready
+		_faceCache->decodeNext();
 	}
 
 	unloadNode();
@@ -867,6 +873,11 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 
 	// The effects can only be created after running the node init scripts
 	_node->initEffects();
+
+	if (_state->getViewType() == kCube) {
+		NodePtr nodeData = _db->getNodeData(_state->getLocationNode(), roomID, ageID);
+		_faceCache->prefetchNeighbours(nodeData, newRoomName);
+	}
 	_shakeEffect = ShakeEffect::create(this);
 	_rotationEffect = RotationEffect::create(this);
 
@@ -79,6 +79,7 @@ class ScriptedMovie;
 class ShakeEffect;
 class RotationEffect;
 class Transition;
+class FaceCache;
 struct NodeData;
 struct Myst3GameDescription;
 
@@ -101,6 +102,7 @@ public:
 	Menu *_menu;
 	Database *_db;
 	Sound *_sound;
+	FaceCache *_faceCache;
 	Ambient *_ambient;
 
 	Common::RandomSource *_rnd;
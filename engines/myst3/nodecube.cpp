@@ -20,8 +20,10 @@
  */
 
 #include "engines/myst3/archive.h"
+#include "engines/myst3/facecache.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/myst3.h"
+#include "engines/myst3/state.h"
 
 #include "common/debug.h"
 
@@ -31,6 +33,8 @@ NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 		Node(vm, id) {
 	_is3D = true;
 
+	Common::String room = _vm->_db->getRoomName(_vm->_state->getLocationRoom(), _vm->_state->getLocationAge());
+
 	for (int i = 0; i < 6; i++) {
 		ResourceDescription jpegDesc = _vm->getFileDescription("", id, i + 1, Archive::kCubeFace);
 
@@ -38,7 +42,13 @@ NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 			error("Face %d does not exist", id);
 
 		_faces[i] = new Face(_vm, true);
-		_faces[i]->setTextureFromJPEG(&jpegDesc);
+
+		// The face may have been decoded ahead of time while on a neighbouring node
+		Graphics::Surface *bitmap = _vm->_faceCache->takeFace(room, id, i);
+		if (bitmap)
+			_faces[i]->setTextureFromBitmap(bitmap);
+		else
+			_faces[i]->setTextureFromJPEG(&jpegDesc);
 	}
 }
 
@@ -39,6 +39,8 @@
 
 namespace Scumm {
 
+extern const char *nameOfResType(ResType type);
+
 void debugC(int channel, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
@@ -87,6 +89,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("cosdump",   WRAP_METHOD(ScummDebugger, Cmd_Cosdump));
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
+	registerCmd("resources", WRAP_METHOD(ScummDebugger, Cmd_Resources));
 
 	if (_vm->_game.id == GID_LOOM)
 		registerCmd("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
@@ -1408,6 +1411,34 @@ bool ScummDebugger::Cmd_Passcode(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_Resources(int argc, const char **argv) {
+	ResourceManager *res = _vm->_res;
+
+	debugPrintf("Heap: %d bytes allocated\n", res->getHeapSize());
+	debugPrintf("%-12s %6s %9s %7s %7s %7s %7s %9s %7s\n", "Type", "Loaded", "Bytes", "Allocs", "Loads", "Reloads", "Expired", "ExpBytes", "LoadMs");
+
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		const ResourceManager::ResTypeData &typeData = res->_types[type];
+		uint32 loadedNum = 0, loadedSize = 0;
+
+		for (uint idx = 0; idx < typeData.size(); idx++) {
+			if (typeData[idx]._address) {
+				loadedNum++;
+				loadedSize += typeData[idx]._size;
+			}
+		}
+
+		if (!loadedNum && !typeData._numAllocs)
+			continue;
+
+		debugPrintf("%-12s %6d %9d %7d %7d %7d %7d %9d %7d\n", nameOfResType(type), loadedNum, loadedSize,
+			typeData._numAllocs, typeData._numLoads, typeData._numReloads, typeData._numExpired,
+			typeData._expiredSize, typeData.getAverageLoadTime());
+	}
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	_vm->resetCursors();
 	detach();
@@ -60,6 +60,7 @@ private:
 	bool Cmd_Script(int argc, const char **argv);
 	bool Cmd_PrintScript(int argc, const char **argv);
 	bool Cmd_ImportRes(int argc, const char **argv);
+	bool Cmd_Resources(int argc, const char **argv);
 
 	bool Cmd_PrintDraft(int argc, const char **argv);
 	bool Cmd_PrintGrail(int argc, const char **argv);
@@ -591,6 +591,12 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	if (vs->h == 0)
 		return;
 
+	// The NES output relies on the exact strip widths, see drawStripToScreen()
+	if (_coalesceDirtyStrips && _game.platform != Common::kPlatformNES) {
+		updateDirtyScreenCoalesced(vs);
+		return;
+	}
+
 	int i;
 	int w = 8;
 	int start = 0;
@@ -607,19 +613,74 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 				w += 8;
 				continue;
 			}
-#ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
-			if (_game.platform == Common::kPlatformFMTowns && vs->number == kBannerVirtScreen) {
-				int scl = _textSurfaceMultiplier;
-				towns_drawStripToScreen(vs, start * 8 * scl, (vs->topline + top) * scl, start * 8 * scl, top * scl, w * scl, bottom - top);
-			} else 
-#endif
-				drawStripToScreen(vs, start * 8, w, top, bottom);
+			drawDirtyStripsToScreen(vs, start, w, top, bottom);
 			w = 8;
 		}
 		start = i + 1;
 	}
 }
 
+/**
+ * Like updateDirtyScreen(), but neighboring dirty strips are merged into one
+ * rectangle even if their dirty ranges differ, as long as less than half of
+ * the merged rectangle was not dirty. Redrawing a few clean lines is a lot
+ * cheaper than composing, converting and uploading each strip on its own.
+ */
+void ScummEngine::updateDirtyScreenCoalesced(VirtScreen *vs) {
+	int start = -1;
+	int top = 0, bottom = 0;
+	int dirtyArea = 0;
+
+	for (int i = 0; i < _gdi->_numStrips; i++) {
+		if (!vs->bdirty[i]) {
+			if (start >= 0) {
+				drawDirtyStripsToScreen(vs, start, (i - start) * 8, top, bottom);
+				start = -1;
+			}
+			continue;
+		}
+
+		const int stripTop = vs->tdirty[i];
+		const int stripBottom = vs->bdirty[i];
+		const int stripArea = 8 * MAX(stripBottom - stripTop, 0);
+		vs->tdirty[i] = vs->h;
+		vs->bdirty[i] = 0;
+
+		if (start >= 0) {
+			const int mergedTop = MIN(top, stripTop);
+			const int mergedBottom = MAX(bottom, stripBottom);
+			const int mergedArea = (i - start + 1) * 8 * (mergedBottom - mergedTop);
+
+			if (mergedArea <= 2 * (dirtyArea + stripArea)) {
+				top = mergedTop;
+				bottom = mergedBottom;
+				dirtyArea += stripArea;
+				continue;
+			}
+
+			drawDirtyStripsToScreen(vs, start, (i - start) * 8, top, bottom);
+		}
+
+		start = i;
+		top = stripTop;
+		bottom = stripBottom;
+		dirtyArea = stripArea;
+	}
+
+	if (start >= 0)
+		drawDirtyStripsToScreen(vs, start, (_gdi->_numStrips - start) * 8, top, bottom);
+}
+
+void ScummEngine::drawDirtyStripsToScreen(VirtScreen *vs, int strip, int width, int top, int bottom) {
+#ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
+	if (_game.platform == Common::kPlatformFMTowns && vs->number == kBannerVirtScreen) {
+		int scl = _textSurfaceMultiplier;
+		towns_drawStripToScreen(vs, strip * 8 * scl, (vs->topline + top) * scl, strip * 8 * scl, top * scl, width * scl, bottom - top);
+	} else
+#endif
+		drawStripToScreen(vs, strip * 8, width, top, bottom);
+}
+
 /**
  * Blit the specified rectangle from the given virtual screen to the display.
  * Note: t and b are in *virtual screen* coordinates, while x is relative to
@@ -0,0 +1,109 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef ENABLE_HE
+
+#include "common/system.h"
+#include "common/util.h"
+#include "scumm/he/gfx_comp/span_comp.h"
+
+namespace Scumm {
+
+static void spanTransparentCopy8(byte *dst, const byte *src, int size, byte transparentColor) {
+	while (size-- > 0) {
+		byte value = *src++;
+
+		if (value != transparentColor)
+			*dst = value;
+
+		dst++;
+	}
+}
+
+static void spanTransparentCopy16(uint16 *dst, const uint16 *src, int size, uint16 transparentColor) {
+	while (size-- > 0) {
+		uint16 value = *src++;
+
+		if (value != transparentColor)
+			*dst = value;
+
+		dst++;
+	}
+}
+
+static void spanFill16(uint16 *dst, uint16 color, int size) {
+	while (size-- > 0)
+		*dst++ = color;
+}
+
+static void spanAdditiveMix16(uint16 *dst, const uint16 *src, int size) {
+	while (size-- > 0) {
+		int workColor = *dst;
+		int srcColor = *src++;
+
+		*dst++ = (uint16)(
+			MIN<int>(0x7C00, (workColor & 0x7C00) + (srcColor & 0x7C00)) |
+			MIN<int>(0x03E0, (workColor & 0x03E0) + (srcColor & 0x03E0)) |
+			MIN<int>(0x001F, (workColor & 0x001F) + (srcColor & 0x001F)));
+	}
+}
+
+static void spanSubtractiveMix16(uint16 *dst, const uint16 *src, int size) {
+	while (size-- > 0) {
+		int workColor = *dst;
+		int srcColor = *src++;
+
+		*dst++ = (uint16)(
+			MAX<int>(0x0400, (workColor & 0x7C00) - (srcColor & 0x7C00)) |
+			MAX<int>(0x0020, (workColor & 0x03E0) - (srcColor & 0x03E0)) |
+			MAX<int>(0x0001, (workColor & 0x001F) - (srcColor & 0x001F)));
+	}
+}
+
+static void spanFiftyFiftyMix16(uint16 *dst, const uint16 *src, int size) {
+	while (size-- > 0) {
+		*dst = (uint16)(((*src++ & 0xFBDE) >> 1) + ((*dst & 0xFBDE) >> 1));
+		dst++;
+	}
+}
+
+void initWizSpanOps(WizSpanOps &ops) {
+	ops.transparentCopy8 = spanTransparentCopy8;
+	ops.transparentCopy16 = spanTransparentCopy16;
+	ops.fill16 = spanFill16;
+	ops.additiveMix16 = spanAdditiveMix16;
+	ops.subtractiveMix16 = spanSubtractiveMix16;
+	ops.fiftyFiftyMix16 = spanFiftyFiftyMix16;
+
+#ifdef SCUMMVM_NEON
+	if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		initWizSpanOpsNEON(ops);
+#endif
+
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		initWizSpanOpsSSE2(ops);
+#endif
+}
+
+} // End of namespace Scumm
+
+#endif // ENABLE_HE
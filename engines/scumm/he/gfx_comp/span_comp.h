@@ -0,0 +1,60 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCUMM_HE_GFX_COMP_SPAN_COMP_H
+#define SCUMM_HE_GFX_COMP_SPAN_COMP_H
+
+#ifdef ENABLE_HE
+
+#include "common/scummsys.h"
+
+namespace Scumm {
+
+// Span primitives used by the TRLE decompressors and the raw image blitters
+// once a run has been decoded. The 16-bit variants work on native-endian
+// 555 pixels, like the WIZRAWPIXEL_* mix macros do.
+//
+// The table is filled with the portable implementations first, then the
+// entries are swapped for the vectorized ones the host CPU supports.
+struct WizSpanOps {
+	void (*transparentCopy8)(byte *dst, const byte *src, int size, byte transparentColor);
+	void (*transparentCopy16)(uint16 *dst, const uint16 *src, int size, uint16 transparentColor);
+	void (*fill16)(uint16 *dst, uint16 color, int size);
+	void (*additiveMix16)(uint16 *dst, const uint16 *src, int size);
+	void (*subtractiveMix16)(uint16 *dst, const uint16 *src, int size);
+	void (*fiftyFiftyMix16)(uint16 *dst, const uint16 *src, int size);
+};
+
+void initWizSpanOps(WizSpanOps &ops);
+
+#ifdef SCUMMVM_SSE2
+void initWizSpanOpsSSE2(WizSpanOps &ops);
+#endif
+
+#ifdef SCUMMVM_NEON
+void initWizSpanOpsNEON(WizSpanOps &ops);
+#endif
+
+} // End of namespace Scumm
+
+#endif // ENABLE_HE
+
+#endif
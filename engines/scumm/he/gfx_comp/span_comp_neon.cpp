@@ -0,0 +1,199 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(ENABLE_HE) && defined(SCUMMVM_NEON)
+
+#include "common/util.h"
+#include "scumm/he/gfx_comp/span_comp.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__)
+
+namespace Scumm {
+
+static void spanTransparentCopy8NEON(byte *dst, const byte *src, int size, byte transparentColor) {
+	const uint8x16_t key = vdupq_n_u8(transparentColor);
+
+	for (; size >= 16; size -= 16, src += 16, dst += 16) {
+		uint8x16_t s = vld1q_u8(src);
+		uint8x16_t d = vld1q_u8(dst);
+		vst1q_u8(dst, vbslq_u8(vceqq_u8(s, key), d, s));
+	}
+
+	while (size-- > 0) {
+		byte value = *src++;
+
+		if (value != transparentColor)
+			*dst = value;
+
+		dst++;
+	}
+}
+
+static void spanTransparentCopy16NEON(uint16 *dst, const uint16 *src, int size, uint16 transparentColor) {
+	const uint16x8_t key = vdupq_n_u16(transparentColor);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		uint16x8_t s = vld1q_u16(src);
+		uint16x8_t d = vld1q_u16(dst);
+		vst1q_u16(dst, vbslq_u16(vceqq_u16(s, key), d, s));
+	}
+
+	while (size-- > 0) {
+		uint16 value = *src++;
+
+		if (value != transparentColor)
+			*dst = value;
+
+		dst++;
+	}
+}
+
+static void spanFill16NEON(uint16 *dst, uint16 color, int size) {
+	const uint16x8_t c = vdupq_n_u16(color);
+
+	for (; size >= 8; size -= 8, dst += 8)
+		vst1q_u16(dst, c);
+
+	while (size-- > 0)
+		*dst++ = color;
+}
+
+// Splits eight 555 pixels into their 5-bit components, one per lane...
+#define SPAN_UNPACK_555(_p, _r, _g, _b)               \
+	_r = vandq_u16(vshrq_n_u16(_p, 10), channelMask); \
+	_g = vandq_u16(vshrq_n_u16(_p, 5), channelMask);  \
+	_b = vandq_u16(_p, channelMask)
+
+#define SPAN_PACK_555(_r, _g, _b) \
+	vorrq_u16(vorrq_u16(vshlq_n_u16(_r, 10), vshlq_n_u16(_g, 5)), _b)
+
+static void spanAdditiveMix16NEON(uint16 *dst, const uint16 *src, int size) {
+	const uint16x8_t channelMask = vdupq_n_u16(0x1F);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		uint16x8_t s = vld1q_u16(src);
+		uint16x8_t d = vld1q_u16(dst);
+		uint16x8_t sr, sg, sb, dr, dg, db;
+
+		SPAN_UNPACK_555(s, sr, sg, sb);
+		SPAN_UNPACK_555(d, dr, dg, db);
+
+		dr = vminq_u16(vaddq_u16(dr, sr), channelMask);
+		dg = vminq_u16(vaddq_u16(dg, sg), channelMask);
+		db = vminq_u16(vaddq_u16(db, sb), channelMask);
+
+		vst1q_u16(dst, SPAN_PACK_555(dr, dg, db));
+	}
+
+	while (size-- > 0) {
+		int workColor = *dst;
+		int srcColor = *src++;
+
+		*dst++ = (uint16)(
+			MIN<int>(0x7C00, (workColor & 0x7C00) + (srcColor & 0x7C00)) |
+			MIN<int>(0x03E0, (workColor & 0x03E0) + (srcColor & 0x03E0)) |
+			MIN<int>(0x001F, (workColor & 0x001F) + (srcColor & 0x001F)));
+	}
+}
+
+static void spanSubtractiveMix16NEON(uint16 *dst, const uint16 *src, int size) {
+	const uint16x8_t channelMask = vdupq_n_u16(0x1F);
+	const int16x8_t one = vdupq_n_s16(1);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		uint16x8_t s = vld1q_u16(src);
+		uint16x8_t d = vld1q_u16(dst);
+		uint16x8_t sr, sg, sb, dr, dg, db;
+
+		SPAN_UNPACK_555(s, sr, sg, sb);
+		SPAN_UNPACK_555(d, dr, dg, db);
+
+		dr = vreinterpretq_u16_s16(vmaxq_s16(vreinterpretq_s16_u16(vsubq_u16(dr, sr)), one));
+		dg = vreinterpretq_u16_s16(vmaxq_s16(vreinterpretq_s16_u16(vsubq_u16(dg, sg)), one));
+		db = vreinterpretq_u16_s16(vmaxq_s16(vreinterpretq_s16_u16(vsubq_u16(db, sb)), one));
+
+		vst1q_u16(dst, SPAN_PACK_555(dr, dg, db));
+	}
+
+	while (size-- > 0) {
+		int workColor = *dst;
+		int srcColor = *src++;
+
+		*dst++ = (uint16)(
+			MAX<int>(0x0400, (workColor & 0x7C00) - (srcColor & 0x7C00)) |
+			MAX<int>(0x0020, (workColor & 0x03E0) - (srcColor & 0x03E0)) |
+			MAX<int>(0x0001, (workColor & 0x001F) - (srcColor & 0x001F)));
+	}
+}
+
+#undef SPAN_UNPACK_555
+#undef SPAN_PACK_555
+
+static void spanFiftyFiftyMix16NEON(uint16 *dst, const uint16 *src, int size) {
+	const uint16x8_t hiBits = vdupq_n_u16(0xFBDE);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		uint16x8_t s = vshrq_n_u16(vandq_u16(vld1q_u16(src), hiBits), 1);
+		uint16x8_t d = vshrq_n_u16(vandq_u16(vld1q_u16(dst), hiBits), 1);
+		vst1q_u16(dst, vaddq_u16(s, d));
+	}
+
+	while (size-- > 0) {
+		*dst = (uint16)(((*src++ & 0xFBDE) >> 1) + ((*dst & 0xFBDE) >> 1));
+		dst++;
+	}
+}
+
+void initWizSpanOpsNEON(WizSpanOps &ops) {
+	ops.transparentCopy8 = spanTransparentCopy8NEON;
+	ops.transparentCopy16 = spanTransparentCopy16NEON;
+	ops.fill16 = spanFill16NEON;
+	ops.additiveMix16 = spanAdditiveMix16NEON;
+	ops.subtractiveMix16 = spanSubtractiveMix16NEON;
+	ops.fiftyFiftyMix16 = spanFiftyFiftyMix16NEON;
+}
+
+} // End of namespace Scumm
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__)
+
+#endif // ENABLE_HE && SCUMMVM_NEON
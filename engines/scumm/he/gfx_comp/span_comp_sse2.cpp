@@ -0,0 +1,203 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(ENABLE_HE) && defined(SCUMMVM_SSE2)
+
+#include "common/util.h"
+#include "scumm/he/gfx_comp/span_comp.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Scumm {
+
+static FORCEINLINE __m128i select(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static void spanTransparentCopy8SSE2(byte *dst, const byte *src, int size, byte transparentColor) {
+	const __m128i key = _mm_set1_epi8((char)transparentColor);
+
+	for (; size >= 16; size -= 16, src += 16, dst += 16) {
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i d = _mm_loadu_si128((const __m128i *)dst);
+		_mm_storeu_si128((__m128i *)dst, select(_mm_cmpeq_epi8(s, key), d, s));
+	}
+
+	while (size-- > 0) {
+		byte value = *src++;
+
+		if (value != transparentColor)
+			*dst = value;
+
+		dst++;
+	}
+}
+
+static void spanTransparentCopy16SSE2(uint16 *dst, const uint16 *src, int size, uint16 transparentColor) {
+	const __m128i key = _mm_set1_epi16((short)transparentColor);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i d = _mm_loadu_si128((const __m128i *)dst);
+		_mm_storeu_si128((__m128i *)dst, select(_mm_cmpeq_epi16(s, key), d, s));
+	}
+
+	while (size-- > 0) {
+		uint16 value = *src++;
+
+		if (value != transparentColor)
+			*dst = value;
+
+		dst++;
+	}
+}
+
+static void spanFill16SSE2(uint16 *dst, uint16 color, int size) {
+	const __m128i c = _mm_set1_epi16((short)color);
+
+	for (; size >= 8; size -= 8, dst += 8)
+		_mm_storeu_si128((__m128i *)dst, c);
+
+	while (size-- > 0)
+		*dst++ = color;
+}
+
+// Splits eight 555 pixels into their 5-bit components, one per lane...
+#define SPAN_UNPACK_555(_p, _r, _g, _b)                      \
+	_r = _mm_and_si128(_mm_srli_epi16(_p, 10), channelMask); \
+	_g = _mm_and_si128(_mm_srli_epi16(_p, 5), channelMask);  \
+	_b = _mm_and_si128(_p, channelMask)
+
+#define SPAN_PACK_555(_r, _g, _b) \
+	_mm_or_si128(_mm_or_si128(_mm_slli_epi16(_r, 10), _mm_slli_epi16(_g, 5)), _b)
+
+static void spanAdditiveMix16SSE2(uint16 *dst, const uint16 *src, int size) {
+	const __m128i channelMask = _mm_set1_epi16(0x1F);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i d = _mm_loadu_si128((const __m128i *)dst);
+		__m128i sr, sg, sb, dr, dg, db;
+
+		SPAN_UNPACK_555(s, sr, sg, sb);
+		SPAN_UNPACK_555(d, dr, dg, db);
+
+		dr = _mm_min_epi16(_mm_add_epi16(dr, sr), channelMask);
+		dg = _mm_min_epi16(_mm_add_epi16(dg, sg), channelMask);
+		db = _mm_min_epi16(_mm_add_epi16(db, sb), channelMask);
+
+		_mm_storeu_si128((__m128i *)dst, SPAN_PACK_555(dr, dg, db));
+	}
+
+	while (size-- > 0) {
+		int workColor = *dst;
+		int srcColor = *src++;
+
+		*dst++ = (uint16)(
+			MIN<int>(0x7C00, (workColor & 0x7C00) + (srcColor & 0x7C00)) |
+			MIN<int>(0x03E0, (workColor & 0x03E0) + (srcColor & 0x03E0)) |
+			MIN<int>(0x001F, (workColor & 0x001F) + (srcColor & 0x001F)));
+	}
+}
+
+static void spanSubtractiveMix16SSE2(uint16 *dst, const uint16 *src, int size) {
+	const __m128i channelMask = _mm_set1_epi16(0x1F);
+	const __m128i one = _mm_set1_epi16(1);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i d = _mm_loadu_si128((const __m128i *)dst);
+		__m128i sr, sg, sb, dr, dg, db;
+
+		SPAN_UNPACK_555(s, sr, sg, sb);
+		SPAN_UNPACK_555(d, dr, dg, db);
+
+		dr = _mm_max_epi16(_mm_sub_epi16(dr, sr), one);
+		dg = _mm_max_epi16(_mm_sub_epi16(dg, sg), one);
+		db = _mm_max_epi16(_mm_sub_epi16(db, sb), one);
+
+		_mm_storeu_si128((__m128i *)dst, SPAN_PACK_555(dr, dg, db));
+	}
+
+	while (size-- > 0) {
+		int workColor = *dst;
+		int srcColor = *src++;
+
+		*dst++ = (uint16)(
+			MAX<int>(0x0400, (workColor & 0x7C00) - (srcColor & 0x7C00)) |
+			MAX<int>(0x0020, (workColor & 0x03E0) - (srcColor & 0x03E0)) |
+			MAX<int>(0x0001, (workColor & 0x001F) - (srcColor & 0x001F)));
+	}
+}
+
+#undef SPAN_UNPACK_555
+#undef SPAN_PACK_555
+
+static void spanFiftyFiftyMix16SSE2(uint16 *dst, const uint16 *src, int size) {
+	const __m128i hiBits = _mm_set1_epi16((short)0xFBDE);
+
+	for (; size >= 8; size -= 8, src += 8, dst += 8) {
+		__m128i s = _mm_srli_epi16(_mm_and_si128(_mm_loadu_si128((const __m128i *)src), hiBits), 1);
+		__m128i d = _mm_srli_epi16(_mm_and_si128(_mm_loadu_si128((const __m128i *)dst), hiBits), 1);
+		_mm_storeu_si128((__m128i *)dst, _mm_add_epi16(s, d));
+	}
+
+	while (size-- > 0) {
+		*dst = (uint16)(((*src++ & 0xFBDE) >> 1) + ((*dst & 0xFBDE) >> 1));
+		dst++;
+	}
+}
+
+void initWizSpanOpsSSE2(WizSpanOps &ops) {
+	ops.transparentCopy8 = spanTransparentCopy8SSE2;
+	ops.transparentCopy16 = spanTransparentCopy16SSE2;
+	ops.fill16 = spanFill16SSE2;
+	ops.additiveMix16 = spanAdditiveMix16SSE2;
+	ops.subtractiveMix16 = spanSubtractiveMix16SSE2;
+	ops.fiftyFiftyMix16 = spanFiftyFiftyMix16SSE2;
+}
+
+} // End of namespace Scumm
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // ENABLE_HE && SCUMMVM_SSE2
@@ -423,168 +423,189 @@ void Wiz::trleFLIPDecompressPrim(
 		&sourceRect, extraPtr, conversionTable, functionPtr);
 }
 
+#define TRLE_SPAN_CHUNK_SIZE 64
+
+void Wiz::trleFLIPSpanMixMemset16(void (*mixFn)(uint16 *, const uint16 *, int), WizRawPixel16 *dstPtr, WizRawPixel mixColor, int size) {
+	WizRawPixel16 colorSpan[TRLE_SPAN_CHUNK_SIZE];
+	int count = MIN<int>(size, TRLE_SPAN_CHUNK_SIZE);
+
+	_spanOps.fill16(colorSpan, mixColor, count);
+
+	while (size > 0) {
+		count = MIN<int>(size, TRLE_SPAN_CHUNK_SIZE);
+		mixFn(dstPtr, colorSpan, count);
+		dstPtr += count;
+		size -= count;
+	}
+}
+
+void Wiz::trleFLIPSpanMixCopy16(void (*mixFn)(uint16 *, const uint16 *, int), WizRawPixel16 *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable, bool backwards) {
+	const WizRawPixel16 *conversion16 = (const WizRawPixel16 *)conversionTable;
+	WizRawPixel16 colorSpan[TRLE_SPAN_CHUNK_SIZE];
+
+	// Convert the source pixels a chunk at a time, and mix them in; the chunks
+	// of backwards runs are stored reversed so that the mixers always walk
+	// the destination forward...
+	while (size > 0) {
+		int count = MIN<int>(size, TRLE_SPAN_CHUNK_SIZE);
+
+		if (!backwards) {
+			for (int i = 0; i < count; i++)
+				colorSpan[i] = conversion16[*srcPtr++];
+
+			mixFn(dstPtr, colorSpan, count);
+			dstPtr += count;
+		} else {
+			for (int i = count; --i >= 0;)
+				colorSpan[i] = conversion16[*srcPtr++];
+
+			mixFn(dstPtr - (count - 1), colorSpan, count);
+			dstPtr -= count;
+		}
+
+		size -= count;
+	}
+}
+
 void Wiz::trleFLIPFiftyFiftyMixPixelMemset(WizRawPixel *dstPtr, WizRawPixel mixColor, int size) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixMemset16(_spanOps.fiftyFiftyMix16, (WizRawPixel16 *)dstPtr, mixColor, size);
+		return;
+	}
+
 	WizRawPixel adjustedColor = WIZRAWPIXEL_50_50_PREMIX_COLOR(mixColor);
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			*dst8 = WIZRAWPIXEL_50_50_MIX(
-				adjustedColor, WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
-			dst8++;
-		} else {
-			*dst16 = WIZRAWPIXEL_50_50_MIX(
-				adjustedColor, WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst16));
-			dst16++;
-		}
+		*dst8 = WIZRAWPIXEL_50_50_MIX(
+			adjustedColor, WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
+		dst8++;
 	}
 }
 
 void Wiz::trleFLIPFiftyFiftyMixForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixCopy16(_spanOps.fiftyFiftyMix16, (WizRawPixel16 *)dstPtr, srcPtr, size, conversionTable, false);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst8 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
-			dst8++;
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst16 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst16));
-			dst16++;
-		}
+		WizRawPixel srcColor = *srcPtr++;
+		*dst8 = WIZRAWPIXEL_50_50_MIX(
+			WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
+			WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
+		dst8++;
 	}
 }
 
 void Wiz::trleFLIPFiftyFiftyMixBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixCopy16(_spanOps.fiftyFiftyMix16, (WizRawPixel16 *)dstPtr, srcPtr, size, conversionTable, true);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst8 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
-			dst8--;
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			*dst16 = WIZRAWPIXEL_50_50_MIX(
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-				WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst16));
-			dst16--;
-		}
+		WizRawPixel srcColor = *srcPtr++;
+		*dst8 = WIZRAWPIXEL_50_50_MIX(
+			WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
+			WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst8));
+		dst8--;
 	}
 }
 
 void Wiz::trleFLIPAdditivePixelMemset(WizRawPixel *dstPtr, WizRawPixel mixColor, int size) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixMemset16(_spanOps.additiveMix16, (WizRawPixel16 *)dstPtr, mixColor, size);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel workColor = *dst8;
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, mixColor);
-		} else {
-			WizRawPixel workColor = *dst16;
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_ADDITIVE_MIX(workColor, mixColor);
-		}
+		WizRawPixel workColor = *dst8;
+		*dst8++ = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, mixColor);
 	}
 }
 
 void Wiz::trleFLIPAdditiveForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixCopy16(_spanOps.additiveMix16, (WizRawPixel16 *)dstPtr, srcPtr, size, conversionTable, false);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
-
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
+		WizRawPixel srcColor = *srcPtr++;
+		WizRawPixel workColor = *dst8;
 
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		}
+		*dst8++ = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
 	}
 }
 
 void Wiz::trleFLIPAdditiveBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixCopy16(_spanOps.additiveMix16, (WizRawPixel16 *)dstPtr, srcPtr, size, conversionTable, true);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
-
-			*dst8-- = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
+		WizRawPixel srcColor = *srcPtr++;
+		WizRawPixel workColor = *dst8;
 
-			*dst16-- = (WizRawPixel16)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
-		}
+		*dst8-- = (WizRawPixel8)WIZRAWPIXEL_ADDITIVE_MIX(workColor, srcColor);
 	}
 }
+
 void Wiz::trleFLIPSubtractivePixelMemset(WizRawPixel *dstPtr, WizRawPixel mixColor, int size) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixMemset16(_spanOps.subtractiveMix16, (WizRawPixel16 *)dstPtr, mixColor, size);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel workColor = *dst8;
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, mixColor);
-		} else {
-			WizRawPixel workColor = *dst16;
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, mixColor);
-		}
+		WizRawPixel workColor = *dst8;
+		*dst8++ = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, mixColor);
 	}
 }
 
 void Wiz::trleFLIPSubtractiveForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixCopy16(_spanOps.subtractiveMix16, (WizRawPixel16 *)dstPtr, srcPtr, size, conversionTable, false);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
-
-			*dst8++ = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
+		WizRawPixel srcColor = *srcPtr++;
+		WizRawPixel workColor = *dst8;
 
-			*dst16++ = (WizRawPixel16)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		}
+		*dst8++ = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
 	}
 }
 
 void Wiz::trleFLIPSubtractiveBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
+	if (_uses16BitColor) {
+		trleFLIPSpanMixCopy16(_spanOps.subtractiveMix16, (WizRawPixel16 *)dstPtr, srcPtr, size, conversionTable, true);
+		return;
+	}
+
 	WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 
 	while (size-- > 0) {
-		if (!_uses16BitColor) {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst8;
+		WizRawPixel srcColor = *srcPtr++;
+		WizRawPixel workColor = *dst8;
 
-			*dst8-- = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		} else {
-			WizRawPixel srcColor = convert8BppToRawPixel(*srcPtr++, conversionTable);
-			WizRawPixel workColor = *dst16;
-
-			*dst16-- = (WizRawPixel16)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
-		}
+		*dst8-- = (WizRawPixel8)WIZRAWPIXEL_SUBTRACTIVE_MIX(workColor, srcColor);
 	}
 }
 
@@ -600,119 +621,92 @@ void Wiz::trleFLIPRemapDestPixels(WizRawPixel *dstPtr, int size, const byte *loo
 }
 
 void Wiz::trleFLIPForwardPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16++ = (WizRawPixel16)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		} else {
-			*buf8++ = (WizRawPixel8)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		}
-	}
-
 	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
-	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		const WizRawPixel16 *conversion16 = (const WizRawPixel16 *)conversionTable;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+
+		while (size-- > 0)
+			*buf16++ = conversion16[*srcPtr++];
+	} else if (size > 0) {
+		memcpy(dstPtr, srcPtr, size);
 	}
 }
 
 void Wiz::trleFLIPBackwardsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16-- = (WizRawPixel16)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		} else {
-			*buf8-- = (WizRawPixel8)convert8BppToRawPixel(*srcPtr++, conversionTable);
-		}
-	}
-
 	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
+		const WizRawPixel16 *conversion16 = (const WizRawPixel16 *)conversionTable;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+
+		while (size-- > 0)
+			*buf16-- = conversion16[*srcPtr++];
 	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+
+		while (size-- > 0)
+			*buf8-- = *srcPtr++;
 	}
 }
 
 void Wiz::trleFLIPForwardLookupPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16++ = (WizRawPixel16)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		} else {
-			*buf8++ = (WizRawPixel8)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		}
-	}
-
 	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
+		const WizRawPixel16 *conversion16 = (const WizRawPixel16 *)conversionTable;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+
+		while (size-- > 0)
+			*buf16++ = conversion16[*(lookupTable + *srcPtr++)];
 	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+
+		while (size-- > 0)
+			*buf8++ = *(lookupTable + *srcPtr++);
 	}
 }
 
 void Wiz::trleFLIPBackwardsLookupPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable, const WizRawPixel *conversionTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
-
-	while (size-- > 0) {
-		if (_uses16BitColor) {
-			*buf16-- = (WizRawPixel16)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		} else {
-			*buf8-- = (WizRawPixel8)convert8BppToRawPixel(*(lookupTable + *srcPtr++), conversionTable);
-		}
-	}
-
 	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
+		const WizRawPixel16 *conversion16 = (const WizRawPixel16 *)conversionTable;
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+
+		while (size-- > 0)
+			*buf16-- = conversion16[*(lookupTable + *srcPtr++)];
 	} else {
-		dstPtr = (WizRawPixel *)buf8;
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+
+		while (size-- > 0)
+			*buf8-- = *(lookupTable + *srcPtr++);
 	}
 }
 
 void Wiz::trleFLIPForwardMixColorsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+	if (_uses16BitColor) {
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
 
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
+		while (size-- > 0)
+			*buf16++ = *srcPtr++;
+	} else {
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+
+		while (size-- > 0) {
 			*buf8 = *(lookupTable + ((*srcPtr++) * 256) + *buf8);
 			buf8++;
-		} else {
-			*buf16++ = *srcPtr++;
 		}
 	}
-
-	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
-	} else {
-		dstPtr = (WizRawPixel *)buf8;
-	}
 }
 
 void Wiz::trleFLIPBackwardsMixColorsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable) {
-	WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
-	WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
+	if (_uses16BitColor) {
+		WizRawPixel16 *buf16 = (WizRawPixel16 *)dstPtr;
 
-	while (size-- > 0) {
-		if (!_uses16BitColor) {
+		while (size-- > 0)
+			*buf16-- = *srcPtr++;
+	} else {
+		WizRawPixel8 *buf8 = (WizRawPixel8 *)dstPtr;
+
+		while (size-- > 0) {
 			*buf8 = *(lookupTable + ((*srcPtr++) * 256) + *buf8);
 			buf8--;
-		} else {
-			*buf16-- = *srcPtr++;
 		}
 	}
-
-	if (_uses16BitColor) {
-		dstPtr = (WizRawPixel *)buf16;
-	} else {
-		dstPtr = (WizRawPixel *)buf8;
-	}
 }
 
 static void trleFLIPAdditiveDecompressLineForward(Wiz *wiz, WizRawPixel *destPtr, const byte *dataStream, int skipAmount, int decompAmount, const byte *extraPtr, const WizRawPixel *conversionTable) {
@@ -954,38 +954,18 @@ void Wiz::pgTransparentSimpleBlit(WizSimpleBitmap *destBM, Common::Rect *destRec
 
 	// Left or right?
 	if (sourceRect->left <= sourceRect->right) {
-		soff = sw - cw;
-		doff = dw - cw;
-
 		while (--ch >= 0) {
 			if (!_uses16BitColor) {
-				for (int x = cw; --x >= 0;) {
-					value = *s8++;
-
-					if (value != tColor) {
-						*d8++ = (WizRawPixel8)value;
-					} else {
-						d8++;
-					}
-				}
+				_spanOps.transparentCopy8(d8, s8, cw, (WizRawPixel8)tColor);
 
-				s8 += soff;
-				d8 += doff;
+				s8 += sw;
+				d8 += dw;
 			} else {
-				for (int x = cw; --x >= 0;) {
-					value = *s16++;
-
-					if (value != tColor) {
-						*d16++ = (WizRawPixel16)value;
-					} else {
-						d16++;
-					}
-				}
+				_spanOps.transparentCopy16(d16, s16, cw, (WizRawPixel16)tColor);
 
-				s16 += soff;
-				d16 += doff;
+				s16 += sw;
+				d16 += dw;
 			}
-
 		}
 
 	} else {
@@ -2008,9 +1988,7 @@ void Wiz::memcpy8BppConversion(void *dstPtr, const void *srcPtr, size_t count, c
 
 void Wiz::rawPixelMemset(void *dstPtr, int value, size_t count) {
 	if (_uses16BitColor) {
-		WizRawPixel16 *dst16Bit = (WizRawPixel16 *)dstPtr;
-		for (size_t i = 0; i < count; i++)
-			WRITE_LE_UINT16(&dst16Bit[i], value);
+		_spanOps.fill16((WizRawPixel16 *)dstPtr, TO_LE_16((uint16)value), (int)count);
 	} else {
 		WizRawPixel8 *dst8Bit = (WizRawPixel8 *)dstPtr;
 		memset(dst8Bit, value, count);
@@ -46,6 +46,8 @@ Wiz::Wiz(ScummEngine_v71he *vm) : _vm(vm) {
 	memset(&_polygons, 0, sizeof(_polygons));
 	_useWizClipRect = false;
 	_uses16BitColor = (_vm->_game.features & GF_16BIT_COLOR);
+
+	initWizSpanOps(_spanOps);
 }
 
 void Wiz::clearWizBuffer() {
@@ -471,7 +473,11 @@ WizPxShrdBuffer Wiz::drawAWizPrimEx(int globNum, int state, int x, int y, int z,
 			if (findRectOverlap(&destRect, &clipRect)) {
 				// If neither foreground or background, copy to both
 				if ((flags & kWRFBackground) || ((flags & (kWRFBackground | kWRFForeground)) == 0)) {
-					_vm->backgroundToForegroundBlit(destRect);
+					if (_batchWizUpdates) {
+						batchWizBlitRect(destRect);
+					} else {
+						_vm->backgroundToForegroundBlit(destRect);
+					}
 				} else {
 					++destRect.bottom;
 					_vm->markRectAsDirty(kMainVirtScreen, destRect);
@@ -1101,11 +1107,82 @@ void Wiz::processWizImagePolyCaptureCmd(const WizImageCommand *params) {
 	_vm->_res->setModified(rtImage, params->image);
 }
 
+bool Wiz::canSkipBufferedWizDraw(int index) {
+	if (index == 0)
+		return false;
+
+	const WizBufferElement *prev = &_wizBuffer[index - 1];
+	const WizBufferElement *cur = &_wizBuffer[index];
+
+	// Drawing the very same image again on top of itself only changes
+	// anything if the image is blended with what's already there...
+	if (cur->shadow || cur->zbuffer || (cur->flags & (kWRFUseShadow | kWRFPolygon | kWRFPrint | kWRFAlloc | kWRFSpecialRenderBitMask)))
+		return false;
+
+	return cur->image == prev->image && cur->state == prev->state &&
+		cur->x == prev->x && cur->y == prev->y && cur->z == prev->z &&
+		cur->flags == prev->flags && cur->shadow == prev->shadow &&
+		cur->zbuffer == prev->zbuffer && cur->palette == prev->palette;
+}
+
+void Wiz::batchWizBlitRect(const Common::Rect &rect) {
+	// Drop the rects which are already covered, and let a new rect swallow
+	// the ones it covers; the union of two rects is only taken when it
+	// doesn't add any area, since the blit would overwrite the foreground
+	// there...
+	for (uint i = 0; i < _batchedWizBlitRects.size(); i++) {
+		Common::Rect &r = _batchedWizBlitRects[i];
+
+		if (r.left <= rect.left && r.top <= rect.top && r.right >= rect.right && r.bottom >= rect.bottom)
+			return;
+
+		if (rect.left <= r.left && rect.top <= r.top && rect.right >= r.right && rect.bottom >= r.bottom) {
+			_batchedWizBlitRects.remove_at(i--);
+			continue;
+		}
+
+		if (r.left == rect.left && r.right == rect.right && r.top <= rect.bottom + 1 && rect.top <= r.bottom + 1) {
+			Common::Rect merged(r.left, MIN(r.top, rect.top), r.right, MAX(r.bottom, rect.bottom));
+			_batchedWizBlitRects.remove_at(i);
+			batchWizBlitRect(merged);
+			return;
+		}
+
+		if (r.top == rect.top && r.bottom == rect.bottom && r.left <= rect.right + 1 && rect.left <= r.right + 1) {
+			Common::Rect merged(MIN(r.left, rect.left), r.top, MAX(r.right, rect.right), r.bottom);
+			_batchedWizBlitRects.remove_at(i);
+			batchWizBlitRect(merged);
+			return;
+		}
+	}
+
+	_batchedWizBlitRects.push_back(rect);
+}
+
+void Wiz::flushBatchedWizUpdates() {
+	for (uint i = 0; i < _batchedWizBlitRects.size(); i++)
+		_vm->backgroundToForegroundBlit(_batchedWizBlitRects[i]);
+
+	_batchedWizBlitRects.clear();
+}
+
 void Wiz::flushAWizBuffer() {
 	if (_wizBufferIndex == 0)
 		return;
 
+	// Images drawn to the background are only copied to the foreground once
+	// the whole buffer has been rendered; as soon as an image goes straight
+	// to the foreground the pending copies have to be done first, or they
+	// would end up on top of it...
+	_batchWizUpdates = true;
+
 	for (int i = 0; i < _wizBufferIndex; i++) {
+		if (canSkipBufferedWizDraw(i))
+			continue;
+
+		if (_wizBuffer[i].flags & (kWRFForeground | kWRFPolygon))
+			flushBatchedWizUpdates();
+
 		drawAWiz(
 			_wizBuffer[i].image, _wizBuffer[i].state,
 			_wizBuffer[i].x, _wizBuffer[i].y, _wizBuffer[i].z,
@@ -1117,6 +1194,9 @@ void Wiz::flushAWizBuffer() {
 			0);
 	}
 
+	flushBatchedWizUpdates();
+	_batchWizUpdates = false;
+
 	_wizBufferIndex = 0;
 }
 
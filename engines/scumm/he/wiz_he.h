@@ -24,7 +24,9 @@
 
 //#define WIZ_DEBUG_BUFFERS
 
+#include "common/array.h"
 #include "common/rect.h"
+#include "scumm/he/gfx_comp/span_comp.h"
 
 namespace Scumm {
 
@@ -652,6 +654,9 @@ public:
 	bool _uses16BitColor = false;
 	int _wizActiveShadow = 0;
 
+	// Run primitives for the decoded spans, picked for the host CPU...
+	WizSpanOps _spanOps;
+
 	void deleteLocalPolygons();
 	void polygonLoad(const uint8 *polData);
 	void set4Polygon(int id, bool flag, int vert1x, int vert1y, int vert2x, int vert2y, int vert3x, int vert3y, int vert4x, int vert4y);
@@ -715,6 +720,8 @@ public:
 	void handleRotate270SpecialCase(int image, int state, int x, int y, int shadow, int angle, int scale, const Common::Rect *clipRect, int32 flags, WizSimpleBitmap *optionalBitmapOverride, const WizRawPixel *optionalColorConversionTable);
 
 	void flushAWizBuffer();
+	void flushBatchedWizUpdates();
+	bool canSkipBufferedWizDraw(int index);
 
 	void getWizSpot(int resId, int state, int32 &x, int32 &y);
 	void getWizSpot(int resId, int32 &x, int32 &y); // HE80
@@ -816,6 +823,13 @@ public:
 private:
 	ScummEngine_v71he *_vm;
 
+	// While flushing the draw buffer, the background to foreground blits
+	// of the images are collected here and issued once for the batch...
+	bool _batchWizUpdates = false;
+	Common::Array<Common::Rect> _batchedWizBlitRects;
+
+	void batchWizBlitRect(const Common::Rect &rect);
+
 
 public:
 	/* Drawing Primitives
@@ -1074,6 +1088,8 @@ public:
 	void trleFLIPBackwardsLookupPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable, const WizRawPixel *conversionTable);
 	void trleFLIPForwardMixColorsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable);
 	void trleFLIPBackwardsMixColorsPixelCopy(WizRawPixel *dstPtr, const byte *srcPtr, int size, const byte *lookupTable);
+	void trleFLIPSpanMixMemset16(void (*mixFn)(uint16 *, const uint16 *, int), WizRawPixel16 *dstPtr, WizRawPixel mixColor, int size);
+	void trleFLIPSpanMixCopy16(void (*mixFn)(uint16 *, const uint16 *, int), WizRawPixel16 *dstPtr, const byte *srcPtr, int size, const WizRawPixel *conversionTable, bool backwards);
 
 
 	/*
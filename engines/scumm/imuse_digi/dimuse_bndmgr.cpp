@@ -148,6 +148,8 @@ BundleMgr::BundleMgr(const ScummEngine *vm, BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile(vm);
 	_compInputBuff = nullptr;
+	_blockCache = nullptr;
+	_blockCacheCounter = 0;
 }
 
 BundleMgr::~BundleMgr() {
@@ -193,10 +195,9 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 	assert(_bundleTable);
 	_compTableLoaded = false;
 	_isUncompressed = false;
-	_outputSize = 0;
 	_lastBlockDecompressedSize = 0;
 	_curDecompressedFilePos = 0;
-	_lastBlock = -1;
+	_blockCacheCounter = 0;
 
 	return true;
 }
@@ -211,13 +212,14 @@ void BundleMgr::close() {
 		_curDecompressedFilePos = 0;
 		_compTableLoaded = false;
 		_isUncompressed = false;
-		_lastBlock = -1;
-		_outputSize = 0;
 		_curSampleId = -1;
 		free(_compTable);
 		_compTable = nullptr;
 		free(_compInputBuff);
 		_compInputBuff = nullptr;
+		free(_blockCache);
+		_blockCache = nullptr;
+		_blockCacheCounter = 0;
 	}
 }
 
@@ -254,9 +256,59 @@ bool BundleMgr::loadCompTable(int32 index) {
 	_compInputBuff = (byte *)malloc(maxSize + 1);
 	assert(_compInputBuff);
 
+	_blockCache = (BlockCacheEntry *)malloc(sizeof(BlockCacheEntry) * DIMUSE_BUN_CACHE_BLOCKS);
+	assert(_blockCache);
+	for (int i = 0; i < DIMUSE_BUN_CACHE_BLOCKS; i++) {
+		_blockCache[i].block = -1;
+		_blockCache[i].outputSize = 0;
+		_blockCache[i].lastUsed = 0;
+	}
+
 	return true;
 }
 
+BundleMgr::BlockCacheEntry *BundleMgr::decompressBlock(int32 block) {
+	BlockCacheEntry *entry = &_blockCache[0];
+	for (int i = 0; i < DIMUSE_BUN_CACHE_BLOCKS; i++) {
+		if (_blockCache[i].block == block) {
+			_blockCache[i].lastUsed = ++_blockCacheCounter;
+			return &_blockCache[i];
+		}
+
+		// Evict the least recently used block
+		if (_blockCache[i].lastUsed < entry->lastUsed)
+			entry = &_blockCache[i];
+	}
+
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[_curSampleId].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	entry->outputSize = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, entry->data, _compTable[block].size);
+
+	if (entry->outputSize > DIMUSE_BUN_CHUNK_SIZE) {
+		error("_outputSize: %d", entry->outputSize);
+	}
+
+	entry->block = block;
+	entry->lastUsed = ++_blockCacheCounter;
+	return entry;
+}
+
+void BundleMgr::readAhead(int32 offset, int numBlocks) {
+	// Decompress the blocks following the streamer position ahead of time, so
+	// that the next readFile() call only has to copy already decoded data
+	if (!_file->isOpen() || !_compTableLoaded || _isUncompressed || _curSampleId == -1)
+		return;
+
+	int32 firstBlock = offset / DIMUSE_BUN_CHUNK_SIZE;
+	int32 lastBlock = MIN<int32>(firstBlock + numBlocks, _numCompItems) - 1;
+
+	for (int32 i = firstBlock; i <= lastBlock; i++) {
+		decompressBlock(i);
+	}
+}
+
 int32 BundleMgr::seekFile(int32 offset, int mode) {
 	// We don't actually seek the file, but instead try to find that the specified offset exists
 	// within the decompressed blocks, and save that offset in _curDecompressedFilePos
@@ -349,20 +401,8 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 		skip = (_curDecompressedFilePos + headerSize) % DIMUSE_BUN_CHUNK_SIZE; // Excess length after the last block
 
 		for (i = firstBlock; i <= lastBlock; i++) {
-			if (_lastBlock != i) {
-				// CMI hack: one more zero byte at the end of input buffer
-				_compInputBuff[_compTable[i].size] = 0;
-				_file->seek(_bundleTable[found->index].offset + _compTable[i].offset, SEEK_SET);
-				_file->read(_compInputBuff, _compTable[i].size);
-				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-
-				if (_outputSize > DIMUSE_BUN_CHUNK_SIZE) {
-					error("_outputSize: %d", _outputSize);
-				}
-				_lastBlock = i;
-			}
-
-			outputSize = _outputSize;
+			BlockCacheEntry *entry = decompressBlock(i);
+			outputSize = entry->outputSize;
 
 			if (header_outside) {
 				outputSize -= skip;
@@ -379,7 +419,7 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 
 			assert(finalSize + outputSize <= blocksFinalSize);
 
-			memcpy(*comp_final + finalSize, _compOutputBuff + skip, outputSize);
+			memcpy(*comp_final + finalSize, entry->data + skip, outputSize);
 			finalSize += outputSize;
 
 			size -= outputSize;
@@ -74,6 +74,15 @@ private:
 		int32 codec;
 	};
 
+	// Decompressed COMP blocks, kept around so that seeks and read-ahead
+	// don't have to go through the codecs again
+	struct BlockCacheEntry {
+		int32 block;
+		int32 outputSize;
+		uint32 lastUsed;
+		byte data[DIMUSE_BUN_CHUNK_SIZE];
+	};
+
 	BundleDirCache *_cache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable;
@@ -88,11 +97,11 @@ private:
 	bool _compTableLoaded;
 	bool _isUncompressed;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
-	int _outputSize;
-	int _lastBlock;
+	BlockCacheEntry *_blockCache;
+	uint32 _blockCacheCounter;
 	bool loadCompTable(int32 index);
+	BlockCacheEntry *decompressBlock(int32 block);
 
 public:
 
@@ -104,6 +113,7 @@ public:
 	Common::SeekableReadStream *getFile(const char *filename, int32 &offset, int32 &size);
 	int32 seekFile(int32 offset, int size);
 	int32 readFile(const char *name, int32 size, byte **compFinal, bool headerOutside);
+	void readAhead(int32 offset, int numBlocks);
 	bool isExtCompBun(byte gameId);
 };
 
@@ -187,6 +187,7 @@ private:
 	void streamerQueryStream(IMuseDigiStream *streamPtr, int32 &bufSize, int32 &criticalSize, int32 &freeSpace, int &paused);
 	int streamerFeedStream(IMuseDigiStream *streamPtr, uint8 *srcBuf, int32 sizeToFeed, int paused);
 	int streamerFetchData(IMuseDigiStream *streamPtr);
+	void streamerReadAhead();
 	void streamerSetLoopFlag(IMuseDigiStream *streamPtr, int offset);
 	void streamerRemoveLoopFlag(IMuseDigiStream *streamPtr);
 
@@ -256,6 +256,21 @@ int IMuseDigiFilesHandler::read(int soundId, uint8 *buf, int32 size, int bufId)
 	return 0;
 }
 
+void IMuseDigiFilesHandler::readAhead(int soundId, int32 offset) {
+	// Only bundle sounds (DIG & COMI) are compressed in blocks, so there's
+	// nothing to decode ahead of time for the FT sound engine
+	if (_engine->isEngineDisabled() || _engine->isFTSoundEngine() || soundId == 0)
+		return;
+
+	// A soundId > 10000 is a SAN cutscene
+	if ((_vm->_game.id == GID_DIG && !(_vm->_game.features & GF_DEMO)) && (soundId > kTalkSoundID))
+		return;
+
+	ImuseDigiSndMgr::SoundDesc *s = _sound->findSoundById(soundId);
+	if (s && s->inUse && s->bundle)
+		s->bundle->readAhead(offset, DIMUSE_BUN_READ_AHEAD);
+}
+
 IMuseDigiSndBuffer *IMuseDigiFilesHandler::getBufInfo(int bufId) {
 	if (bufId > 0 && bufId <= 4) {
 		return &_soundBuffers[bufId];
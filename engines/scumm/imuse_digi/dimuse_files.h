@@ -57,6 +57,7 @@ public:
 	int getNextSound(int soundId);
 	int seek(int soundId, int32 offset, int mode, int bufId);
 	int read(int soundId, uint8 *buf, int32 size, int bufId);
+	void readAhead(int soundId, int32 offset);
 	IMuseDigiSndBuffer *getBufInfo(int bufId);
 	int openSound(int soundId);
 	void closeSound(int soundId);
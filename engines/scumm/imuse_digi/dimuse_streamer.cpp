@@ -374,6 +374,19 @@ int IMuseDigital::streamerFetchData(IMuseDigiStream *streamPtr) {
 	return 0;
 }
 
+void IMuseDigital::streamerReadAhead() {
+	// Have the bundle manager decode the blocks right after the current
+	// load position of each stream, so that the next fetch doesn't have to
+	if (_isEarlyDiMUSE)
+		return;
+
+	for (int l = 0; l < DIMUSE_MAX_STREAMS; l++) {
+		if (_streams[l].soundId && !_streams[l].paused && _streams[l].curOffset < _streams[l].endOffset) {
+			_filesHandler->readAhead(_streams[l].soundId, _streams[l].curOffset);
+		}
+	}
+}
+
 void IMuseDigital::streamerSetLoopFlag(IMuseDigiStream *streamPtr, int offset) {
 	streamPtr->vocLoopFlag = 1;
 	streamPtr->vocLoopTriggerOffset = offset;
@@ -112,7 +112,9 @@ int IMuseDigital::waveSwitchStream(int oldSoundId, int newSoundId, uint8 *crossf
 
 int IMuseDigital::waveProcessStreams() {
 	Common::StackLock lock(*_mutex);
-	return streamerProcessStreams();
+	int result = streamerProcessStreams();
+	streamerReadAhead();
+	return result;
 }
 
 int  IMuseDigital::waveQueryStream(int soundId, int32 &bufSize, int32 &criticalSize, int32 &freeSpace, int &paused) {
@@ -132,6 +132,16 @@ MODULE_OBJS += \
 	smush/codec47ARM.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	smush/codec47_neon.o
+endif
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	smush/codec47_sse2.o
+endif
+
 endif
 
 ifdef USE_ARM_GFX_ASM
@@ -165,6 +175,7 @@ MODULE_OBJS += \
 	he/cup_player_he.o \
 	he/gfx_comp/aux_comp.o \
 	he/gfx_comp/mrle_comp.o \
+	he/gfx_comp/span_comp.o \
 	he/gfx_comp/trle_comp.o \
 	he/gfx_primitives_he.o \
 	he/logic_he.o \
@@ -204,6 +215,16 @@ MODULE_OBJS += \
 	he/moonbase/moonbase_fow.o \
 	he/moonbase/moonbase_gfx.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	he/gfx_comp/span_comp_neon.o
+endif
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	he/gfx_comp/span_comp_sse2.o
+endif
+
 ifdef USE_ENET
 MODULE_OBJS += \
 	dialog-createsession.o \
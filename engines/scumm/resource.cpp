@@ -49,6 +49,7 @@ enum {
 	RF_USAGE_MAX = RF_USAGE,
 
 	RS_MODIFIED = 0x10,
+	RS_EXPIRED = 0x20,
 	RF_OFFHEAP = 0x40
 };
 
@@ -633,12 +634,33 @@ void ScummEngine::ensureResourceLoaded(ResType type, ResId idx) {
 	_resourceAccessMutex.lock();
 #endif
 
-	loadResource(type, idx);
+	uint32 loadStart = _system->getMillis();
+	if (loadResource(type, idx))
+		_res->recordLoad(type, idx, _system->getMillis() - loadStart);
 
 	if (_game.version == 5 && type == rtRoom && (int)idx == _roomResource)
 		VAR(VAR_ROOM_FLAG) = 1;
 }
 
+void ScummEngine::preloadRoomResources(int room) {
+	// Load the scripts and costumes stored in the room that is being entered
+	// while there is heap to spare, so that the room doesn't stall on them
+	// once it is running. This never makes other resources expire.
+	static const ResType preloadTypes[] = { rtScript, rtCostume };
+
+	for (int i = 0; i < ARRAYSIZE(preloadTypes); i++) {
+		ResType type = preloadTypes[i];
+		for (ResId idx = 1; idx < _res->_types[type].size(); idx++) {
+			if (!_res->isHeapBelowThreshold())
+				return;
+
+			ResourceManager::Resource &res = _res->_types[type][idx];
+			if (res._roomno == room && !res._address && res._roomoffs != RES_INVALID_OFFSET)
+				ensureResourceLoaded(type, idx);
+		}
+	}
+}
+
 int ScummEngine::loadResource(ResType type, ResId idx) {
 	int roomNr;
 	uint32 fileOffs;
@@ -869,6 +891,7 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
+	_types[type]._numAllocs++;
 	setResourceCounter(type, idx, 1);
 
 	_vm->_insideCreateResource--;
@@ -901,11 +924,21 @@ void ResourceManager::Resource::nuke() {
 ResourceManager::ResTypeData::ResTypeData() {
 	_mode = kDynamicResTypeMode;
 	_tag = 0;
+	_numAllocs = 0;
+	_numLoads = 0;
+	_numReloads = 0;
+	_numExpired = 0;
+	_expiredSize = 0;
+	_loadTime = 0;
 }
 
 ResourceManager::ResTypeData::~ResTypeData() {
 }
 
+uint32 ResourceManager::ResTypeData::getAverageLoadTime() const {
+	return _numLoads ? _loadTime / _numLoads : 0;
+}
+
 ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_allocatedSize = 0;
 	_maxHeapThreshold = 0;
@@ -1073,12 +1106,31 @@ void ResourceManager::Resource::setOffHeap() {
 	_status |= RF_OFFHEAP;
 }
 
+void ResourceManager::Resource::setExpired(bool expired) {
+	if (expired)
+		_status |= RS_EXPIRED;
+	else
+		_status &= ~RS_EXPIRED;
+}
+
+bool ResourceManager::Resource::wasExpired() const {
+	return (_status & RS_EXPIRED) != 0;
+}
+
 void ResourceManager::Resource::setOnHeap() {
 	_status &= ~RF_OFFHEAP;
 }
 
+uint64 ResourceManager::getExpireScore(ResType type, const Resource &res) const {
+	// Resources which haven't been used for a long time are the most likely
+	// to stay unused, so the usage counter still weighs in first. Among those,
+	// prefer the ones that free the most memory, but hold on to the types that
+	// are slow to load again (e.g. compressed or read from CD).
+	return (uint64)res.getResourceCounter() * (res._size + 1) / (_types[type].getAverageLoadTime() + 1);
+}
+
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
+	uint64 best_score;
 	ResType best_type;
 	int best_res = 0;
 	uint32 oldAllocatedSize;
@@ -1095,7 +1147,7 @@ void ResourceManager::expireResources(uint32 size) {
 
 	do {
 		best_type = rtInvalid;
-		best_counter = 2;
+		best_score = 0;
 
 		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 			if (_types[type]._mode != kDynamicResTypeMode) {
@@ -1104,11 +1156,14 @@ void ResourceManager::expireResources(uint32 size) {
 				ResId idx = _types[type].size();
 				while (idx-- > 0) {
 					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
+					// Resources used since the last expiration (counter 1) are kept
+					if (!tmp.isLocked() && tmp.getResourceCounter() >= 2 && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+						uint64 score = getExpireScore(type, tmp);
+						if (score >= best_score) {
+							best_score = score;
+							best_type = type;
+							best_res = idx;
+						}
 					}
 				}
 			}
@@ -1116,6 +1171,9 @@ void ResourceManager::expireResources(uint32 size) {
 
 		if (!best_type)
 			break;
+		_types[best_type]._numExpired++;
+		_types[best_type]._expiredSize += _types[best_type][best_res]._size;
+		_types[best_type][best_res].setExpired(true);
 		nukeResource(best_type, best_res);
 	} while (size + _allocatedSize > _minHeapThreshold);
 
@@ -1124,6 +1182,19 @@ void ResourceManager::expireResources(uint32 size) {
 	debugC(DEBUG_RESOURCE, "Expired resources, mem %d -> %d", oldAllocatedSize, _allocatedSize);
 }
 
+void ResourceManager::recordLoad(ResType type, ResId idx, uint32 loadTime) {
+	if (!validateResource("recordLoad", type, idx))
+		return;
+
+	Resource &res = _types[type][idx];
+	_types[type]._numLoads++;
+	_types[type]._loadTime += loadTime;
+	if (res.wasExpired()) {
+		_types[type]._numReloads++;
+		res.setExpired(false);
+	}
+}
+
 void ResourceManager::freeResources() {
 	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 		ResId idx = _types[type].size();
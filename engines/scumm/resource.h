@@ -144,6 +144,9 @@ public:
 		void setOffHeap();
 		void setOnHeap();
 		bool isOffHeap() const;
+
+		void setExpired(bool expired);
+		bool wasExpired() const;
 	};
 
 	/**
@@ -164,9 +167,27 @@ public:
 		 */
 		uint32 _tag;
 
+		/**
+		 * Allocation, loading and eviction counters for this resource type.
+		 * These feed the eviction policy (through the measured load time)
+		 * and are shown by the "resources" debugger command.
+		 */
+		uint32 _numAllocs;
+		uint32 _numLoads;
+		uint32 _numReloads;
+		uint32 _numExpired;
+		uint32 _expiredSize;
+		uint32 _loadTime;
+
 	public:
 		ResTypeData();
 		~ResTypeData();
+
+		/**
+		 * Average time (in milliseconds) it took to load a resource of this
+		 * type from the game data files.
+		 */
+		uint32 getAverageLoadTime() const;
 	};
 	ResTypeData _types[rtLast + 1];
 
@@ -181,6 +202,7 @@ public:
 
 	void setHeapThreshold(int min, int max);
 	uint32 getHeapSize() { return _allocatedSize; }
+	bool isHeapBelowThreshold() const { return _allocatedSize < _minHeapThreshold; }
 
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
@@ -226,10 +248,17 @@ public:
 
 	void resourceStats();
 
+	/**
+	 * Account for a resource which has just been loaded from the game data
+	 * files, taking loadTime milliseconds.
+	 */
+	void recordLoad(ResType type, ResId idx, uint32 loadTime);
+
 //protected:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
 	void expireResources(uint32 size);
+	uint64 getExpireScore(ResType type, const Resource &res) const;
 };
 
 } // End of namespace Scumm
@@ -162,9 +162,13 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 	if (VAR_ROOM_RESOURCE != 0xFF)
 		VAR(VAR_ROOM_RESOURCE) = _roomResource;
 
-	if (room != 0)
+	if (room != 0) {
 		ensureResourceLoaded(rtRoom, room);
 
+		if (_preloadRoomResources)
+			preloadRoomResources(_roomResource);
+	}
+
 	clearRoomObjects();
 
 	if (_currentRoom == 0) {
@@ -432,6 +432,12 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 				  _language == Common::JA_JPN;
 
 	_enableHECompetitiveOnlineMods = ConfMan.getBool("enable_competitive_mods");
+
+	if (ConfMan.hasKey("preload_room_resources"))
+		_preloadRoomResources = ConfMan.getBool("preload_room_resources");
+
+	if (ConfMan.hasKey("coalesce_dirty_strips"))
+		_coalesceDirtyStrips = ConfMan.getBool("coalesce_dirty_strips");
 }
 
 
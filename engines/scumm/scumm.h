@@ -917,6 +917,7 @@ protected:
 	// Various options useful for debugging
 	bool _dumpScripts = false;
 	bool _hexdumpScripts = false;
+	bool _preloadRoomResources = false;
 	bool _showStack = false;
 	bool _debugMode = false;
 
@@ -1103,6 +1104,8 @@ public:
 	void ensureResourceLoaded(ResType type, ResId idx);
 
 protected:
+	void preloadRoomResources(int room);
+
 	Common::Mutex _resourceAccessMutex; // Used in getResourceSize(), getResourceAddress() and findResource()
 										// to avoid race conditions between the audio thread of Digital iMUSE
 										// and the main SCUMM thread
@@ -1418,9 +1421,12 @@ protected:
 	byte *_hercCGAScaleBuf = nullptr;
 	bool _enableEGADithering = false;
 	bool _supportsEGADithering = false;
+	bool _coalesceDirtyStrips = true;
 
 	virtual void drawDirtyScreenParts();
 	void updateDirtyScreen(VirtScreenNumber slot);
+	void updateDirtyScreenCoalesced(VirtScreen *vs);
+	void drawDirtyStripsToScreen(VirtScreen *vs, int strip, int width, int top, int bottom);
 	void drawStripToScreen(VirtScreen *vs, int x, int width, int top, int bottom);
 
 	void mac_markScreenAsDirty(int x, int y, int w, int h);
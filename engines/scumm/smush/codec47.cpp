@@ -22,9 +22,11 @@
 
 #include "common/endian.h"
 #include "common/textconsole.h"
+#include "common/system.h"
 #include "common/util.h"
 #include "scumm/bomp.h"
 #include "scumm/smush/codec47.h"
+#include "scumm/smush/codec47_simd.h"
 
 namespace Scumm {
 
@@ -69,12 +71,6 @@ namespace Scumm {
 		(dst)[1] = val;         \
 	} while (0)
 
-#define MOTION_OFFSET_TABLE_SIZE 0xF8
-#define PROCESS_SUBBLOCKS        0xFF
-#define FILL_SINGLE_COLOR        0xFE
-#define DRAW_GLYPH               0xFD
-#define COPY_PREV_BUFFER         0xFC
-
 static const  int8 codecGlyph4XVec[] = {
   0, 1, 2, 3, 3, 3, 3, 2, 1, 0, 0, 0, 1, 2, 2, 1,
 };
@@ -274,6 +270,16 @@ void SmushDeltaGlyphsDecoder::makeTablesInterpolation(int sideLength) {
 				}
 			}
 
+#ifdef SMUSH_CODEC47_SIMD
+			byte *mask = (sideLength == 8) ? _glyphMasksBig : _glyphMasksSmall;
+			if (mask) {
+				mask += (x * 16 + y) * sideLength * sideLength;
+				for (i = 0; i < sideLength * sideLength; i++) {
+					mask[i] = tableSmallBig[i] ? 0xFF : 0x00;
+				}
+			}
+#endif
+
 			if (sideLength == 8) {
 				for (i = 64 - 1; i >= 0; i--) {
 					if (tableSmallBig[i] != 0) {
@@ -535,12 +541,57 @@ void SmushDeltaGlyphsDecoder::decode2(byte *dst, const byte *src, int width, int
 }
 #endif
 
+#ifdef SMUSH_CODEC47_SIMD
+void SmushDeltaGlyphsDecoder::levelSIMD3(byte *dDst) {
+	// 2x2 blocks are too small to gain anything from vector registers,
+	// so this is shared by all the SIMD decoders
+	int32 tmp;
+	byte code = *_dSrc++;
+
+	if (code < MOTION_OFFSET_TABLE_SIZE) {
+		tmp = _table[code] + _offset1;
+		COPY_2X1_LINE(dDst, dDst + tmp);
+		COPY_2X1_LINE(dDst + _dPitch, dDst + _dPitch + tmp);
+	} else if (code == PROCESS_SUBBLOCKS) {
+		COPY_2X1_LINE(dDst, _dSrc + 0);
+		COPY_2X1_LINE(dDst + _dPitch, _dSrc + 2);
+		_dSrc += 4;
+	} else if (code == FILL_SINGLE_COLOR) {
+		byte t = *_dSrc++;
+		FILL_2X1_LINE(dDst, t);
+		FILL_2X1_LINE(dDst + _dPitch, t);
+	} else if (code == COPY_PREV_BUFFER) {
+		tmp = _offset2;
+		COPY_2X1_LINE(dDst, dDst + tmp);
+		COPY_2X1_LINE(dDst + _dPitch, dDst + _dPitch + tmp);
+	} else {
+		byte t = _paramPtr[code];
+		FILL_2X1_LINE(dDst, t);
+		FILL_2X1_LINE(dDst + _dPitch, t);
+	}
+}
+#endif
+
 SmushDeltaGlyphsDecoder::SmushDeltaGlyphsDecoder(int width, int height) : _prevSeqNb(0), _dSrc(nullptr), _paramPtr(nullptr), _dPitch(0), _offset1(0), _offset2(0) {
 	_lastTableWidth = -1;
 	_width = width;
 	_height = height;
 	_tableBig = (byte *)malloc(NGLYPHS * 388);
 	_tableSmall = (byte *)malloc(NGLYPHS * 128);
+#ifdef SMUSH_CODEC47_SIMD
+	_glyphMasksBig = (byte *)malloc(NGLYPHS * 64);
+	_glyphMasksSmall = (byte *)malloc(NGLYPHS * 16);
+	_useSSE2 = false;
+	_useNEON = false;
+	if ((_glyphMasksBig != nullptr) && (_glyphMasksSmall != nullptr)) {
+#ifdef SCUMMVM_SSE2
+		_useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#endif
+#ifdef SCUMMVM_NEON
+		_useNEON = g_system->hasFeature(OSystem::kFeatureCpuNEON);
+#endif
+	}
+#endif
 	if ((_tableBig != nullptr) && (_tableSmall != nullptr)) {
 		makeTablesInterpolation(4);
 		makeTablesInterpolation(8);
@@ -563,6 +614,12 @@ SmushDeltaGlyphsDecoder::~SmushDeltaGlyphsDecoder() {
 		free(_tableSmall);
 		_tableSmall = nullptr;
 	}
+#ifdef SMUSH_CODEC47_SIMD
+	free(_glyphMasksBig);
+	_glyphMasksBig = nullptr;
+	free(_glyphMasksSmall);
+	_glyphMasksSmall = nullptr;
+#endif
 	_lastTableWidth = -1;
 	if (_deltaBuf) {
 		free(_deltaBuf);
@@ -605,6 +662,18 @@ bool SmushDeltaGlyphsDecoder::decode(byte *dst, const byte *src) {
 		break;
 	case 2:
 		if (seqNb == _prevSeqNb + 1) {
+#ifdef SCUMMVM_NEON
+			if (_useNEON) {
+				decode2NEON(_curBuf, gfxData, _width, _height, src + 8);
+				break;
+			}
+#endif
+#ifdef SCUMMVM_SSE2
+			if (_useSSE2) {
+				decode2SSE2(_curBuf, gfxData, _width, _height, src + 8);
+				break;
+			}
+#endif
 			decode2(_curBuf, gfxData, _width, _height, src + 8);
 		}
 		break;
@@ -24,6 +24,10 @@
 
 #include "common/scummsys.h"
 
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+#define SMUSH_CODEC47_SIMD
+#endif
+
 namespace Scumm {
 
 class SmushDeltaGlyphsDecoder {
@@ -51,6 +55,29 @@ private:
 	void level3(byte *d_dst);
 	void decode2(byte *dst, const byte *src, int width, int height, const byte *param_ptr);
 
+#ifdef SMUSH_CODEC47_SIMD
+	// Glyphs expanded to per-pixel byte masks (0xFF for the first color),
+	// so that the SIMD paths can draw them with a single select per row
+	byte *_glyphMasksBig;
+	byte *_glyphMasksSmall;
+	bool _useSSE2;
+	bool _useNEON;
+
+	template<class BlockOps>
+	void levelSIMD1(byte *dDst);
+	template<class BlockOps>
+	void levelSIMD2(byte *dDst);
+	void levelSIMD3(byte *dDst);
+	template<class BlockOps>
+	void decode2SIMD(byte *dst, const byte *src, int width, int height, const byte *paramPtr);
+#endif
+#ifdef SCUMMVM_SSE2
+	void decode2SSE2(byte *dst, const byte *src, int width, int height, const byte *paramPtr);
+#endif
+#ifdef SCUMMVM_NEON
+	void decode2NEON(byte *dst, const byte *src, int width, int height, const byte *paramPtr);
+#endif
+
 public:
 	SmushDeltaGlyphsDecoder(int width, int height);
 	~SmushDeltaGlyphsDecoder();
@@ -0,0 +1,113 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "scumm/smush/codec47.h"
+#include "scumm/smush/codec47_simd.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__)
+
+namespace Scumm {
+
+struct Codec47BlockOpsNEON {
+	static FORCEINLINE void copy8x8(byte *dst, const byte *src, int pitch) {
+		for (int i = 0; i < 8; i++) {
+			vst1_u8(dst, vld1_u8(src));
+			dst += pitch;
+			src += pitch;
+		}
+	}
+
+	static FORCEINLINE void fill8x8(byte *dst, byte val, int pitch) {
+		uint8x8_t v = vdup_n_u8(val);
+		for (int i = 0; i < 8; i++) {
+			vst1_u8(dst, v);
+			dst += pitch;
+		}
+	}
+
+	static FORCEINLINE void glyph8x8(byte *dst, const byte *mask, byte val0, byte val1, int pitch) {
+		uint8x8_t v0 = vdup_n_u8(val0);
+		uint8x8_t v1 = vdup_n_u8(val1);
+		for (int i = 0; i < 8; i++) {
+			vst1_u8(dst, vbsl_u8(vld1_u8(mask), v0, v1));
+			mask += 8;
+			dst += pitch;
+		}
+	}
+
+	static FORCEINLINE void copy4x4(byte *dst, const byte *src, int pitch) {
+		for (int i = 0; i < 4; i++) {
+			WRITE_UINT32(dst, READ_UINT32(src));
+			dst += pitch;
+			src += pitch;
+		}
+	}
+
+	static FORCEINLINE void fill4x4(byte *dst, byte val, int pitch) {
+		uint32 v = val * 0x01010101;
+		for (int i = 0; i < 4; i++) {
+			WRITE_UINT32(dst, v);
+			dst += pitch;
+		}
+	}
+
+	static FORCEINLINE void glyph4x4(byte *dst, const byte *mask, byte val0, byte val1, int pitch) {
+		// The whole 4x4 glyph fits in one register
+		uint32x4_t rows = vreinterpretq_u32_u8(vbslq_u8(vld1q_u8(mask), vdupq_n_u8(val0), vdupq_n_u8(val1)));
+		WRITE_UINT32(dst, vgetq_lane_u32(rows, 0));
+		WRITE_UINT32(dst + pitch, vgetq_lane_u32(rows, 1));
+		WRITE_UINT32(dst + pitch * 2, vgetq_lane_u32(rows, 2));
+		WRITE_UINT32(dst + pitch * 3, vgetq_lane_u32(rows, 3));
+	}
+};
+
+void SmushDeltaGlyphsDecoder::decode2NEON(byte *dst, const byte *src, int width, int height, const byte *paramPtr) {
+	decode2SIMD<Codec47BlockOpsNEON>(dst, src, width, height, paramPtr);
+}
+
+} // End of namespace Scumm
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,115 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCUMM_SMUSH_CODEC_47_SIMD_H
+#define SCUMM_SMUSH_CODEC_47_SIMD_H
+
+#include "common/endian.h"
+#include "scumm/smush/codec47.h"
+
+#define MOTION_OFFSET_TABLE_SIZE 0xF8
+#define PROCESS_SUBBLOCKS        0xFF
+#define FILL_SINGLE_COLOR        0xFE
+#define DRAW_GLYPH               0xFD
+#define COPY_PREV_BUFFER         0xFC
+
+#ifdef SMUSH_CODEC47_SIMD
+
+namespace Scumm {
+
+// The block traversal shared by the vectorized decoders. BlockOps provides
+// the 8x8 and 4x4 copy, fill and glyph primitives for the instruction set;
+// each implementation includes this header and instantiates decode2SIMD()
+// from its own translation unit, so that it gets built with the right
+// target options.
+
+template<class BlockOps>
+void SmushDeltaGlyphsDecoder::levelSIMD2(byte *dDst) {
+	byte code = *_dSrc++;
+
+	if (code < MOTION_OFFSET_TABLE_SIZE) {
+		BlockOps::copy4x4(dDst, dDst + _table[code] + _offset1, _dPitch);
+	} else if (code == PROCESS_SUBBLOCKS) {
+		levelSIMD3(dDst);
+		levelSIMD3(dDst + 2);
+		levelSIMD3(dDst + _dPitch * 2);
+		levelSIMD3(dDst + _dPitch * 2 + 2);
+	} else if (code == FILL_SINGLE_COLOR) {
+		BlockOps::fill4x4(dDst, *_dSrc++, _dPitch);
+	} else if (code == DRAW_GLYPH) {
+		const byte *mask = _glyphMasksSmall + *_dSrc++ * 16;
+		BlockOps::glyph4x4(dDst, mask, _dSrc[0], _dSrc[1], _dPitch);
+		_dSrc += 2;
+	} else if (code == COPY_PREV_BUFFER) {
+		BlockOps::copy4x4(dDst, dDst + _offset2, _dPitch);
+	} else {
+		BlockOps::fill4x4(dDst, _paramPtr[code], _dPitch);
+	}
+}
+
+template<class BlockOps>
+void SmushDeltaGlyphsDecoder::levelSIMD1(byte *dDst) {
+	byte code = *_dSrc++;
+
+	if (code < MOTION_OFFSET_TABLE_SIZE) {
+		BlockOps::copy8x8(dDst, dDst + _table[code] + _offset1, _dPitch);
+	} else if (code == PROCESS_SUBBLOCKS) {
+		levelSIMD2<BlockOps>(dDst);
+		levelSIMD2<BlockOps>(dDst + 4);
+		levelSIMD2<BlockOps>(dDst + _dPitch * 4);
+		levelSIMD2<BlockOps>(dDst + _dPitch * 4 + 4);
+	} else if (code == FILL_SINGLE_COLOR) {
+		BlockOps::fill8x8(dDst, *_dSrc++, _dPitch);
+	} else if (code == DRAW_GLYPH) {
+		const byte *mask = _glyphMasksBig + *_dSrc++ * 64;
+		BlockOps::glyph8x8(dDst, mask, _dSrc[0], _dSrc[1], _dPitch);
+		_dSrc += 2;
+	} else if (code == COPY_PREV_BUFFER) {
+		BlockOps::copy8x8(dDst, dDst + _offset2, _dPitch);
+	} else {
+		BlockOps::fill8x8(dDst, _paramPtr[code], _dPitch);
+	}
+}
+
+template<class BlockOps>
+void SmushDeltaGlyphsDecoder::decode2SIMD(byte *dst, const byte *src, int width, int height, const byte *paramPtr) {
+	_dSrc = src;
+	_paramPtr = paramPtr - MOTION_OFFSET_TABLE_SIZE;
+	int bw = (width + 7) / 8;
+	int bh = (height + 7) / 8;
+	int nextLine = width * 7;
+	_dPitch = width;
+
+	do {
+		int tmpBw = bw;
+		do {
+			levelSIMD1<BlockOps>(dst);
+			dst += 8;
+		} while (--tmpBw);
+		dst += nextLine;
+	} while (--bh);
+}
+
+} // End of namespace Scumm
+
+#endif // SMUSH_CODEC47_SIMD
+
+#endif
@@ -0,0 +1,121 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "scumm/smush/codec47.h"
+#include "scumm/smush/codec47_simd.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Scumm {
+
+struct Codec47BlockOpsSSE2 {
+	static FORCEINLINE __m128i select(__m128i mask, __m128i a, __m128i b) {
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+
+	static FORCEINLINE void copy8x8(byte *dst, const byte *src, int pitch) {
+		for (int i = 0; i < 8; i++) {
+			_mm_storel_epi64((__m128i *)dst, _mm_loadl_epi64((const __m128i *)src));
+			dst += pitch;
+			src += pitch;
+		}
+	}
+
+	static FORCEINLINE void fill8x8(byte *dst, byte val, int pitch) {
+		__m128i v = _mm_set1_epi8((char)val);
+		for (int i = 0; i < 8; i++) {
+			_mm_storel_epi64((__m128i *)dst, v);
+			dst += pitch;
+		}
+	}
+
+	static FORCEINLINE void glyph8x8(byte *dst, const byte *mask, byte val0, byte val1, int pitch) {
+		__m128i v0 = _mm_set1_epi8((char)val0);
+		__m128i v1 = _mm_set1_epi8((char)val1);
+		// Two rows of the glyph per register
+		for (int i = 0; i < 4; i++) {
+			__m128i rows = select(_mm_loadu_si128((const __m128i *)mask), v0, v1);
+			_mm_storel_epi64((__m128i *)dst, rows);
+			_mm_storel_epi64((__m128i *)(dst + pitch), _mm_srli_si128(rows, 8));
+			mask += 16;
+			dst += pitch * 2;
+		}
+	}
+
+	static FORCEINLINE void copy4x4(byte *dst, const byte *src, int pitch) {
+		for (int i = 0; i < 4; i++) {
+			WRITE_UINT32(dst, READ_UINT32(src));
+			dst += pitch;
+			src += pitch;
+		}
+	}
+
+	static FORCEINLINE void fill4x4(byte *dst, byte val, int pitch) {
+		uint32 v = val * 0x01010101;
+		for (int i = 0; i < 4; i++) {
+			WRITE_UINT32(dst, v);
+			dst += pitch;
+		}
+	}
+
+	static FORCEINLINE void glyph4x4(byte *dst, const byte *mask, byte val0, byte val1, int pitch) {
+		// The whole 4x4 glyph fits in one register
+		__m128i rows = select(_mm_loadu_si128((const __m128i *)mask), _mm_set1_epi8((char)val0), _mm_set1_epi8((char)val1));
+		for (int i = 0; i < 4; i++) {
+			WRITE_UINT32(dst, (uint32)_mm_cvtsi128_si32(rows));
+			rows = _mm_srli_si128(rows, 4);
+			dst += pitch;
+		}
+	}
+};
+
+void SmushDeltaGlyphsDecoder::decode2SSE2(byte *dst, const byte *src, int width, int height, const byte *paramPtr) {
+	decode2SIMD<Codec47BlockOpsSSE2>(dst, src, width, height, paramPtr);
+}
+
+} // End of namespace Scumm
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
@@ -550,6 +550,10 @@ static void drawGeneral() {
 
 	ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
 	ImGui::Text("Draw time: %u ms", g_twp->_stats.drawTime);
+	ImGui::Text("Draw calls: %u (%u primitives drawn)", g_twp->_stats.drawCalls, g_twp->_stats.drawRequests);
+	bool batching = g_twp->getGfx().isBatching();
+	if (ImGui::Checkbox("Batch sprites", &batching))
+		g_twp->getGfx().setBatching(batching);
 	ImGui::Text("Update time: %u ms", g_twp->_stats.totalUpdateTime);
 	ImGui::Text("  Update room time: %u ms", g_twp->_stats.updateRoomTime);
 	ImGui::Text("  Update tasks time: %u ms", g_twp->_stats.updateTasksTime);
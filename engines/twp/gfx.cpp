@@ -26,6 +26,9 @@
 
 namespace Twp {
 
+// Caps the size of a single batch upload.
+static const uint kMaxBatchVertices = 16384;
+
 int Color::toInt() const {
 	int r = (rgba.r * 255.f);
 	int g = (rgba.g * 255.f);
@@ -88,6 +91,7 @@ void Texture::bind(const Texture *texture) {
 }
 
 void Texture::capture(Common::Array<byte> &data) {
+	g_twp->getGfx().flush();
 	data.resize(width * height * 4);
 	GLint boundFrameBuffer;
 
@@ -105,6 +109,9 @@ RenderTexture::RenderTexture(const Math::Vector2d &size) {
 	width = size.getX();
 	height = size.getY();
 
+	// the framebuffer binding is changed below
+	g_twp->getGfx().flush();
+
 	// first create the framebuffer
 	glGenFramebuffers(1, &fbo);
 	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
@@ -218,6 +225,7 @@ void Gfx::init() {
 }
 
 void Gfx::clear(const Color &color) {
+	flush();
 	glClearColor(color.rgba.r, color.rgba.g, color.rgba.b, color.rgba.a);
 	glClear(GL_COLOR_BUFFER_BIT);
 }
@@ -243,8 +251,63 @@ void Gfx::drawLinesLoop(Vertex *vertices, int count, const Math::Matrix4 &trsf)
 	drawPrimitives(GL_LINE_LOOP, vertices, count, trsf);
 }
 
+bool Gfx::canBatch(uint32 primitivesType) const {
+	return _batching && primitivesType == GL_TRIANGLES && _shader == &_defaultShader;
+}
+
+void Gfx::addToBatch(Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
+	if (!texture)
+		texture = &_emptyTexture;
+	if (texture != _batchTexture || _batchVertices.size() + v_size > kMaxBatchVertices)
+		flush();
+	_batchTexture = texture;
+	_drawRequests++;
+
+	// The batch is drawn without a transform, so apply it here
+	const uint32 base = _batchVertices.size();
+	for (int i = 0; i < v_size; i++) {
+		Math::Vector3d pos(vertices[i].pos.getX(), vertices[i].pos.getY(), 0.f);
+		trsf.transform(&pos, true);
+		_batchVertices.push_back(Vertex(Math::Vector2d(pos.x(), pos.y()), vertices[i].color, vertices[i].texCoords));
+	}
+
+	if (indices) {
+		for (int i = 0; i < i_size; i++)
+			_batchIndices.push_back(base + indices[i]);
+	} else {
+		for (int i = 0; i < v_size; i++)
+			_batchIndices.push_back(base + i);
+	}
+}
+
+void Gfx::flush() {
+	if (_batchIndices.empty())
+		return;
+
+	drawElements(GL_TRIANGLES, _batchVertices.data(), _batchVertices.size(), _batchIndices.data(), _batchIndices.size(), Math::Matrix4(), _batchTexture);
+	_batchVertices.resize(0);
+	_batchIndices.resize(0);
+	_batchTexture = nullptr;
+}
+
+void Gfx::setBatching(bool batching) {
+	flush();
+	_batching = batching;
+}
+
+void Gfx::resetStats() {
+	_drawCalls = 0;
+	_drawRequests = 0;
+}
+
 void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, const Math::Matrix4 &trsf, Texture *texture) {
-	if (v_size > 0) {
+	if (v_size > 0 && canBatch(primitivesType)) {
+		addToBatch(vertices, v_size, nullptr, 0, trsf, texture);
+	} else if (v_size > 0) {
+		flush();
+		_drawRequests++;
+		_drawCalls++;
+
 		_texture = texture ? texture : &_emptyTexture;
 		GL_CALL(glBindTexture(GL_TEXTURE_2D, _texture->id));
 
@@ -277,49 +340,59 @@ void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, co
 }
 
 void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
-	if (i_size > 0) {
-		int num = _shader->getNumTextures();
-		if (num == 0) {
-			_texture = texture ? texture : &_emptyTexture;
-			GL_CALL(glBindTexture(GL_TEXTURE_2D, _texture->id));
-		} else {
-			for (int i = 0; i < num; i++) {
-				GL_CALL(glBindTexture(GL_TEXTURE_2D, _shader->getTexture(i)));
-			}
+	if (i_size > 0 && canBatch(primitivesType)) {
+		addToBatch(vertices, v_size, indices, i_size, trsf, texture);
+	} else if (i_size > 0) {
+		flush();
+		_drawRequests++;
+		drawElements(primitivesType, vertices, v_size, indices, i_size, trsf, texture);
+	}
+}
+
+void Gfx::drawElements(uint32 primitivesType, Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
+	_drawCalls++;
+
+	int num = _shader->getNumTextures();
+	if (num == 0) {
+		_texture = texture ? texture : &_emptyTexture;
+		GL_CALL(glBindTexture(GL_TEXTURE_2D, _texture->id));
+	} else {
+		for (int i = 0; i < num; i++) {
+			GL_CALL(glBindTexture(GL_TEXTURE_2D, _shader->getTexture(i)));
 		}
+	}
 
-		// set blending
-		GL_CALL(glEnable(GL_BLEND));
-		GL_CALL(glBlendEquationSeparate(GL_FUNC_ADD, GL_FUNC_ADD));
-		GL_CALL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+	// set blending
+	GL_CALL(glEnable(GL_BLEND));
+	GL_CALL(glBlendEquationSeparate(GL_FUNC_ADD, GL_FUNC_ADD));
+	GL_CALL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
 
-		_shader->_shader.use();
+	_shader->_shader.use();
 
-		GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, _vbo));
-		GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * v_size, vertices, GL_STREAM_DRAW));
-		GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo));
-		GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32) * i_size, indices, GL_STREAM_DRAW));
-
-		if (num == 0) {
-			GL_CALL(glActiveTexture(GL_TEXTURE0));
-			GL_CALL(glBindTexture(GL_TEXTURE_2D, _texture->id));
-			GL_CALL(glUniform1i(_shader->getUniformLocation("u_texture"), 0));
-		} else {
-			for (int i = 0; i < num; i++) {
-				GL_CALL(glActiveTexture(GL_TEXTURE0 + i));
-				GL_CALL(glBindTexture(GL_TEXTURE_2D, _shader->getTexture(i)));
-				GL_CALL(glUniform1i(_shader->getTextureLoc(i), i));
-			}
+	GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, _vbo));
+	GL_CALL(glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * v_size, vertices, GL_STREAM_DRAW));
+	GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo));
+	GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32) * i_size, indices, GL_STREAM_DRAW));
+
+	if (num == 0) {
+		GL_CALL(glActiveTexture(GL_TEXTURE0));
+		GL_CALL(glBindTexture(GL_TEXTURE_2D, _texture->id));
+		GL_CALL(glUniform1i(_shader->getUniformLocation("u_texture"), 0));
+	} else {
+		for (int i = 0; i < num; i++) {
+			GL_CALL(glActiveTexture(GL_TEXTURE0 + i));
+			GL_CALL(glBindTexture(GL_TEXTURE_2D, _shader->getTexture(i)));
+			GL_CALL(glUniform1i(_shader->getTextureLoc(i), i));
 		}
+	}
 
-		_shader->_shader.setUniform("u_transform", getFinalTransform(trsf));
-		_shader->applyUniforms();
-		GL_CALL(glDrawElements(primitivesType, i_size, GL_UNSIGNED_INT, NULL));
-		_shader->_shader.unbind();
+	_shader->_shader.setUniform("u_transform", getFinalTransform(trsf));
+	_shader->applyUniforms();
+	GL_CALL(glDrawElements(primitivesType, i_size, GL_UNSIGNED_INT, NULL));
+	_shader->_shader.unbind();
 
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		glDisable(GL_BLEND);
-	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glDisable(GL_BLEND);
 }
 
 void Gfx::draw(Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
@@ -370,6 +443,7 @@ void Gfx::drawSprite(Texture &texture, const Color &color, const Math::Matrix4 &
 }
 
 void Gfx::camera(const Math::Vector2d &size) {
+	flush();
 	_cameraSize = size;
 	_mvp = ortho(0.f, size.getX(), 0.f, size.getY(), -1.f, 1.f);
 }
@@ -379,10 +453,14 @@ Math::Vector2d Gfx::camera() const {
 }
 
 void Gfx::use(Shader *shader) {
-	_shader = shader ? shader : &_defaultShader;
+	Shader *newShader = shader ? shader : &_defaultShader;
+	if (newShader != _shader)
+		flush();
+	_shader = newShader;
 }
 
 void Gfx::setRenderTarget(RenderTexture *target) {
+	flush();
 	if (!target) {
 		glBindFramebuffer(GL_FRAMEBUFFER, _oldFbo);
 		int w = g_twp->_system->getWidth();
@@ -184,9 +184,22 @@ public:
 	void drawSprite(const Common::Rect &textRect, Texture &texture, const Color &color = Color(), const Math::Matrix4 &trsf = Math::Matrix4(), bool flipX = false, bool flipY = false);
 	void drawSprite(Texture &texture, const Color &color = Color(), const Math::Matrix4 &trsf = Math::Matrix4(), bool flipX = false, bool flipY = false);
 
+	// Draws the triangles queued so far. Consecutive triangles drawn with the
+	// default shader and the same texture are merged into a single draw call.
+	void flush();
+	void setBatching(bool batching);
+	bool isBatching() const { return _batching; }
+
+	void resetStats();
+	uint32 getDrawCalls() const { return _drawCalls; }
+	uint32 getDrawRequests() const { return _drawRequests; }
+
 private:
 	Math::Matrix4 getFinalTransform(const Math::Matrix4 &trsf);
 	void noTexture();
+	bool canBatch(uint32 primitivesType) const;
+	void addToBatch(Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture);
+	void drawElements(uint32 primitivesType, Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture);
 
 private:
 	Texture _emptyTexture;
@@ -199,6 +212,12 @@ private:
 	Textures _textures;
 	Texture *_texture = nullptr;
 	int _oldFbo = 0;
+	bool _batching = true;
+	Common::Array<Vertex> _batchVertices;
+	Common::Array<uint32> _batchIndices;
+	Texture *_batchTexture = nullptr;
+	uint32 _drawCalls = 0;
+	uint32 _drawRequests = 0;
 };
 } // namespace Twp
 
@@ -20,7 +20,12 @@
  */
 
 #include "common/archive.h"
+#include "common/config-manager.h"
+#include "common/crc.h"
 #include "common/debug.h"
+#include "common/memstream.h"
+#include "common/savefile.h"
+#include "common/system.h"
 #include "twp/detection.h"
 #include "twp/ggpack.h"
 
@@ -37,6 +42,10 @@ namespace Twp {
 #define GGP_KEYS 8
 #define GGP_ENDOFFSETS 0xFFFFFFFF
 
+// Bump whenever the layout of the cached pack indexes changes
+#define GGP_INDEX_TAG MKTAG('T', 'W', 'P', 'I')
+#define GGP_INDEX_VERSION 1
+
 static const byte bnutKey[] = {
 	0x04, 0x1f, 0x5a, 0xac, 0x5f, 0x79, 0x10, 0xaf, 0x04, 0x1d, 0x46, 0x3a,
 	0x5f, 0x08, 0xee, 0xcb, 0xb5, 0x29, 0x06, 0x2e, 0xf9, 0x4b, 0xca, 0x44, 0x5e,
@@ -578,6 +587,39 @@ bool RangeStream::seek(int64 offset, int whence) {
 	return _s->seek(offset, whence);
 }
 
+static byte xorDecode(byte *data, uint32 size, const byte *keyStream, byte previous) {
+	for (uint32 i = 0; i < size; i++) {
+		byte x = data[i] ^ keyStream[i & 0xFF];
+		data[i] = x ^ previous;
+		previous = x;
+	}
+	return previous;
+}
+
+static XorDecodeProc getXorDecodeProc() {
+#ifdef SCUMMVM_NEON
+	if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		return xorDecodeNEON;
+#endif
+
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		return xorDecodeSSE2;
+#endif
+
+	return xorDecode;
+}
+
+// Decodes a run read at offset pos of an entry. The magic bytes follow the
+// position in the entry while the multiplier follows the position in the
+// run, both repeat every 256 bytes.
+static byte xorDecodeRun(XorDecodeProc decode, byte *data, uint32 size, int pos, const XorKey &key, byte previous) {
+	byte keyStream[256];
+	for (int i = 0; i < 256; i++)
+		keyStream[i] = (byte)(key.magicBytes[(pos + i) & 0x0F] ^ (i * key.multiplier));
+	return decode(data, size, keyStream, previous);
+}
+
 XorStream::XorStream() : _s(nullptr), _size(0) {
 }
 
@@ -587,19 +629,14 @@ bool XorStream::open(Common::SeekableReadStream *stream, int len, const XorKey &
 	_previous = (len & 0xFF);
 	_key = key;
 	_size = len;
+	_decode = getXorDecodeProc();
 	return true;
 }
 
 uint32 XorStream::read(void *dataPtr, uint32 dataSize) {
 	int p = (int)pos();
 	uint32 result = _s->read(dataPtr, dataSize);
-	char *buf = (char *)dataPtr;
-	for (size_t i = 0; i < dataSize; i++) {
-		int x = buf[i] ^ _key.magicBytes[p & 0x0F] ^ (i * _key.multiplier);
-		buf[i] = (char)(x ^ _previous);
-		_previous = x;
-		p++;
-	}
+	_previous = xorDecodeRun(_decode, (byte *)dataPtr, result, p, _key, (byte)_previous);
 	return result;
 }
 
@@ -625,7 +662,7 @@ bool XorStream::seek(int64 offset, int whence) {
 GGPackDecoder::GGPackDecoder() {
 }
 
-bool GGPackDecoder::open(Common::SeekableReadStream *s, const XorKey &key) {
+bool GGPackDecoder::open(Common::SeekableReadStream *s, const XorKey &key, const Common::String &indexName) {
 	_entries.clear();
 	_key = key;
 	_s = s;
@@ -634,11 +671,23 @@ bool GGPackDecoder::open(Common::SeekableReadStream *s, const XorKey &key) {
 	uint32 entriesSize = s->readUint32LE();
 	s->seek(entriesOffset);
 
-	// decode entries
-	XorStream xs;
-	xs.open(s, entriesSize, key);
 	Common::Array<byte> buffer(entriesSize);
-	xs.read(buffer.data(), entriesSize);
+	if (s->read(buffer.data(), entriesSize) != entriesSize)
+		return false;
+
+	// the index built from this directory may already be cached
+	uint32 packSize = (uint32)s->size();
+	uint32 hash = 0;
+	if (!indexName.empty()) {
+		hash = Common::CRC32().crcFast(buffer.data(), entriesSize);
+		if (loadIndex(indexName, packSize, hash)) {
+			debugC(kDebugGGPack, "Index of %s loaded from cache, %d entries", indexName.c_str(), (int)_entries.size());
+			return true;
+		}
+	}
+
+	// decode entries
+	xorDecodeRun(getXorDecodeProc(), buffer.data(), entriesSize, 0, key, (byte)(entriesSize & 0xFF));
 
 	// read entries as hash
 	MemStream ms;
@@ -659,9 +708,67 @@ bool GGPackDecoder::open(Common::SeekableReadStream *s, const XorKey &key) {
 		debugC(kDebugGGPack, "filename: %s, off: %d, size: %d", filename.c_str(), offset, size);
 	}
 
+	if (!indexName.empty())
+		saveIndex(indexName, packSize, hash);
+
+	return true;
+}
+
+bool GGPackDecoder::loadIndex(const Common::String &indexName, uint32 packSize, uint32 hash) {
+	Common::ScopedPtr<Common::InSaveFile> file(g_system->getSavefileManager()->openForLoading(indexName));
+	if (!file)
+		return false;
+
+	if (file->readUint32BE() != GGP_INDEX_TAG || file->readUint32LE() != GGP_INDEX_VERSION)
+		return false;
+	if (file->readUint32LE() != packSize || file->readUint32LE() != hash)
+		return false;
+
+	uint32 count = file->readUint32LE();
+	for (uint32 i = 0; i < count && !file->err() && !file->eos(); i++) {
+		GGPackEntry e;
+		e.offset = (int)file->readUint32LE();
+		e.size = (int)file->readUint32LE();
+		uint16 len = file->readUint16LE();
+		Common::String filename = file->readString(0, len);
+		_entries[filename] = e;
+	}
+
+	// a truncated or damaged index is rebuilt from the pack
+	if (file->err() || file->eos() || _entries.size() != count) {
+		warning("Pack index cache %s is invalid, rebuilding it", indexName.c_str());
+		_entries.clear();
+		return false;
+	}
 	return true;
 }
 
+void GGPackDecoder::saveIndex(const Common::String &indexName, uint32 packSize, uint32 hash) const {
+	Common::MemoryWriteStreamDynamic data(DisposeAfterUse::YES);
+	data.writeUint32BE(GGP_INDEX_TAG);
+	data.writeUint32LE(GGP_INDEX_VERSION);
+	data.writeUint32LE(packSize);
+	data.writeUint32LE(hash);
+	data.writeUint32LE(_entries.size());
+	for (auto it = _entries.begin(); it != _entries.end(); it++) {
+		data.writeUint32LE((uint32)it->_value.offset);
+		data.writeUint32LE((uint32)it->_value.size);
+		data.writeUint16LE(it->_key.size());
+		data.writeString(it->_key);
+	}
+
+	Common::ScopedPtr<Common::OutSaveFile> file(g_system->getSavefileManager()->openForSaving(indexName, false));
+	if (!file)
+		return;
+	file->write(data.getData(), data.size());
+	file->finalize();
+	if (file->err()) {
+		warning("Couldn't write pack index cache %s", indexName.c_str());
+		file.reset();
+		g_system->getSavefileManager()->removeSavefile(indexName);
+	}
+}
+
 GGPackEntryReader::GGPackEntryReader() {}
 
 bool GGPackEntryReader::open(GGPackDecoder &pack, const Common::String &entry) {
@@ -678,17 +785,23 @@ bool GGPackEntryReader::open(GGPackDecoder &pack, const Common::String &entry) {
 	if (!xs.open(&rs, e.size, pack._key))
 		return false;
 
-	_buf.resize(e.size);
-	xs.read(_buf.data(), e.size);
+	_buf.reset(new Common::Array<byte>(e.size));
+	xs.read(_buf->data(), e.size);
 
-	return _ms.open(_buf.data(), e.size);
+	return _ms.open(_buf->data(), e.size);
 }
 
 bool GGPackEntryReader::open(GGPackSet &packs, const Common::String &entry) {
+	_buf = packs.getCached(entry);
+	if (_buf)
+		return _ms.open(_buf->data(), _buf->size());
+
 	for (auto it = packs._packs.begin(); it != packs._packs.end(); it++) {
 		GGPackDecoder *pack = &it->second;
-		if (open(*pack, entry))
+		if (open(*pack, entry)) {
+			packs.addToCache(entry, _buf);
 			return true;
+		}
 	}
 	return false;
 }
@@ -751,8 +864,9 @@ void GGPackSet::init(const XorKey &key) {
 		long index = atol(fileName.c_str() + pos + 1);
 
 		Common::SeekableReadStream *stream = m.createReadStream();
+		Common::String indexName(Common::String::format("%s-%s.idx", ConfMan.getActiveDomainName().c_str(), fileName.c_str()));
 		GGPackDecoder pack;
-		if (stream && pack.open(stream, key)) {
+		if (stream && pack.open(stream, key, indexName)) {
 			_packs[index] = Common::move(pack);
 		}
 	}
@@ -773,6 +887,40 @@ bool GGPackSet::assetExists(const char *asset) {
 	return false;
 }
 
+static bool isCacheable(const Common::String &entry) {
+	return entry.hasSuffixIgnoreCase(".json") || entry.hasSuffixIgnoreCase(".wimpy") ||
+		   entry.hasSuffixIgnoreCase(".nut") || entry.hasSuffixIgnoreCase(".bnut");
+}
+
+GGPackData GGPackSet::getCached(const Common::String &entry) {
+	auto it = _cache.find(entry);
+	if (it == _cache.end())
+		return GGPackData();
+	debugC(kDebugGGPack, "%s found in cache", entry.c_str());
+	it->_value.lastUsed = ++_cacheCounter;
+	return it->_value.data;
+}
+
+void GGPackSet::addToCache(const Common::String &entry, const GGPackData &data) {
+	if (!isCacheable(entry) || data->size() > kMaxCacheSize / 4)
+		return;
+
+	while (!_cache.empty() && _cacheSize + data->size() > kMaxCacheSize) {
+		auto oldest = _cache.begin();
+		for (auto it = _cache.begin(); it != _cache.end(); it++) {
+			if (it->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = it;
+		}
+		_cacheSize -= oldest->_value.data->size();
+		_cache.erase(oldest);
+	}
+
+	CacheEntry &e = _cache[entry];
+	e.data = data;
+	e.lastUsed = ++_cacheCounter;
+	_cacheSize += data->size();
+}
+
 GGHashMapEncoder::GGHashMapEncoder() {
 }
 
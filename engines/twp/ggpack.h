@@ -26,6 +26,7 @@
 #include "common/stream.h"
 #include "common/list.h"
 #include "common/path.h"
+#include "common/ptr.h"
 #include "common/stablemap.h"
 #include "common/formats/json.h"
 
@@ -39,6 +40,19 @@ struct XorKey {
 	int multiplier = 0;
 };
 
+// Removes the XOR layer from a run of pack data in place. keyStream holds
+// the 256 key bytes repeating over the run, previous is the last value of
+// the XOR chain before it and the last one of the run is returned.
+typedef byte (*XorDecodeProc)(byte *data, uint32 size, const byte *keyStream, byte previous);
+
+#ifdef SCUMMVM_SSE2
+byte xorDecodeSSE2(byte *data, uint32 size, const byte *keyStream, byte previous);
+#endif
+
+#ifdef SCUMMVM_NEON
+byte xorDecodeNEON(byte *data, uint32 size, const byte *keyStream, byte previous);
+#endif
+
 class MemStream : public Common::SeekableReadStream {
 public:
 	MemStream();
@@ -92,6 +106,7 @@ private:
 	int _start = 0;
 	int _size = 0;
 	XorKey _key;
+	XorDecodeProc _decode = nullptr;
 };
 
 class RangeStream : public Common::SeekableReadStream {
@@ -167,16 +182,22 @@ public:
 public:
 	GGPackDecoder();
 
-	bool open(Common::SeekableReadStream *s, const XorKey &key);
+	bool open(Common::SeekableReadStream *s, const XorKey &key, const Common::String &indexName = Common::String());
 
 	bool assetExists(const char *asset) { return _entries.contains(asset); }
 
+private:
+	bool loadIndex(const Common::String &indexName, uint32 packSize, uint32 hash);
+	void saveIndex(const Common::String &indexName, uint32 packSize, uint32 hash) const;
+
 private:
 	XorKey _key;
 	GGPackEntries _entries;
 	Common::SeekableReadStream *_s = nullptr;
 };
 
+typedef Common::SharedPtr<Common::Array<byte> > GGPackData;
+
 class GGPackSet {
 public:
 	void init(const XorKey &key);
@@ -184,6 +205,24 @@ public:
 
 	bool containsDLC() const;
 
+	// Decoded entries read again and again, like the room files, scripts
+	// and sprite sheets, are kept until kMaxCacheSize bytes are used, then
+	// the least recently read ones are dropped.
+	GGPackData getCached(const Common::String &entry);
+	void addToCache(const Common::String &entry, const GGPackData &data);
+
+private:
+	struct CacheEntry {
+		GGPackData data;
+		uint32 lastUsed;
+	};
+
+	static const uint32 kMaxCacheSize = 8 * 1024 * 1024;
+
+	Common::HashMap<Common::String, CacheEntry, Common::IgnoreCase_Hash> _cache;
+	uint32 _cacheSize = 0;
+	uint32 _cacheCounter = 0;
+
 public:
 	Common::StableMap<long, GGPackDecoder, Common::Greater<long> > _packs;
 };
@@ -217,7 +256,7 @@ public:
 	bool seek(int64 offset, int whence = SEEK_SET) override;
 
 private:
-	Common::Array<byte> _buf;
+	GGPackData _buf;
 	MemStream _ms;
 };
 
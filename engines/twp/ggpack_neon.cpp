@@ -0,0 +1,76 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "twp/ggpack.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__)
+
+namespace Twp {
+
+byte xorDecodeNEON(byte *data, uint32 size, const byte *keyStream, byte previous) {
+	// See xorDecodeSSE2(), the last lane of the previous block provides the
+	// first byte of the shifted chain.
+	uint8x16_t last = vdupq_n_u8(previous);
+	uint32 i = 0;
+
+	for (; i + 16 <= size; i += 16) {
+		uint8x16_t x = veorq_u8(vld1q_u8(data + i), vld1q_u8(keyStream + (i & 0xFF)));
+		vst1q_u8(data + i, veorq_u8(x, vextq_u8(last, x, 15)));
+		last = x;
+	}
+
+	previous = vgetq_lane_u8(last, 15);
+	for (; i < size; i++) {
+		byte x = data[i] ^ keyStream[i & 0xFF];
+		data[i] = x ^ previous;
+		previous = x;
+	}
+	return previous;
+}
+
+} // namespace Twp
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,78 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "twp/ggpack.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Twp {
+
+byte xorDecodeSSE2(byte *data, uint32 size, const byte *keyStream, byte previous) {
+	// Every output byte only depends on the input and key bytes at its own
+	// position and the one before it, so 16 bytes are decoded at once and
+	// the last XORed value is carried over to the next block.
+	__m128i carry = _mm_cvtsi32_si128(previous);
+	uint32 i = 0;
+
+	for (; i + 16 <= size; i += 16) {
+		__m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + i)), _mm_loadu_si128((const __m128i *)(keyStream + (i & 0xFF))));
+		__m128i prev = _mm_or_si128(_mm_slli_si128(x, 1), carry);
+		_mm_storeu_si128((__m128i *)(data + i), _mm_xor_si128(x, prev));
+		carry = _mm_srli_si128(x, 15);
+	}
+
+	previous = (byte)_mm_cvtsi128_si32(carry);
+	for (; i < size; i++) {
+		byte x = data[i] ^ keyStream[i & 0xFF];
+		data[i] = x ^ previous;
+		previous = x;
+	}
+	return previous;
+}
+
+} // namespace Twp
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
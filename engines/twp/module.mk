@@ -61,6 +61,16 @@ MODULE_OBJS = \
 	squirrel/sqstdrex.o \
 	squirrel/sqstdaux.o \
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	ggpack_neon.o
+endif
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	ggpack_sse2.o
+endif
+
 ifdef USE_IMGUI
 MODULE_OBJS += \
 	debugtools.o \
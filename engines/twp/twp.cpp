@@ -722,6 +722,7 @@ void TwpEngine::setShaderEffect(RoomEffect effect) {
 }
 
 void TwpEngine::draw(RenderTexture *outTexture) {
+	_gfx.resetStats();
 	if (_room) {
 		Math::Vector2d screenSize = _room->getScreenSize();
 		_gfx.camera(screenSize);
@@ -818,6 +819,9 @@ void TwpEngine::draw(RenderTexture *outTexture) {
 
 	// imgui render
 	_gfx.use(nullptr);
+	_gfx.flush();
+	_stats.drawCalls = _gfx.getDrawCalls();
+	_stats.drawRequests = _gfx.getDrawRequests();
 	_system->updateScreen();
 }
 
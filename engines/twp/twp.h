@@ -257,6 +257,8 @@ public:
 		uint32 updateThreadsTime = 0;
 		uint32 updateCallbacksTime = 0;
 		uint32 drawTime = 0;
+		uint32 drawCalls = 0;
+		uint32 drawRequests = 0;
 	} _stats;
 	unique_ptr<Hud> _hud;
 	Inventory _uiInv;
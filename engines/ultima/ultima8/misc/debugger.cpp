@@ -43,6 +43,7 @@
 #include "ultima/ultima8/kernel/object_manager.h"
 #include "ultima/ultima8/misc/id_man.h"
 #include "ultima/ultima8/misc/util.h"
+#include "ultima/ultima8/usecode/uc_list.h"
 #include "ultima/ultima8/usecode/uc_machine.h"
 #include "ultima/ultima8/usecode/bit_set.h"
 #include "ultima/ultima8/world/current_map.h"
@@ -50,6 +51,8 @@
 #include "ultima/ultima8/world/camera_process.h"
 #include "ultima/ultima8/world/get_object.h"
 #include "ultima/ultima8/world/item_factory.h"
+#include "ultima/ultima8/world/item_sorter.h"
+#include "ultima/ultima8/world/loop_script.h"
 #include "ultima/ultima8/world/actors/quick_avatar_mover_process.h"
 #include "ultima/ultima8/world/actors/avatar_mover_process.h"
 #include "ultima/ultima8/world/actors/pathfinder.h"
@@ -100,6 +103,7 @@ Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("GameMapGump::dumpAllMaps", WRAP_METHOD(Debugger, cmdDumpAllMaps));
 	registerCmd("GameMapGump::incrementSortOrder", WRAP_METHOD(Debugger, cmdIncrementSortOrder));
 	registerCmd("GameMapGump::decrementSortOrder", WRAP_METHOD(Debugger, cmdDecrementSortOrder));
+	registerCmd("GameMapGump::sortStats", WRAP_METHOD(Debugger, cmdSortStats));
 
 	registerCmd("Kernel::processTypes", WRAP_METHOD(Debugger, cmdProcessTypes));
 	registerCmd("Kernel::processInfo", WRAP_METHOD(Debugger, cmdProcessInfo));
@@ -166,6 +170,7 @@ Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("QuitGump::verifyQuit", WRAP_METHOD(Debugger, cmdVerifyQuit));
 	registerCmd("ShapeViewerGump::U8ShapeViewer", WRAP_METHOD(Debugger, cmdU8ShapeViewer));
 	registerCmd("RenderSurface::benchmark", WRAP_METHOD(Debugger, cmdBenchmarkRenderSurface));
+	registerCmd("CurrentMap::benchmark", WRAP_METHOD(Debugger, cmdBenchmarkCurrentMap));
 
 #ifdef DEBUG_PATHFINDER
 	registerCmd("Pathfinder::visualDebug", WRAP_METHOD(Debugger, cmdVisualDebugPathfinder));
@@ -649,7 +654,7 @@ void Debugger::dumpCurrentMap() {
 	// Work out the map limits in chunks
 	for (int32 y = 0; y < MAP_NUM_CHUNKS; y++) {
 		for (int32 x = 0; x < MAP_NUM_CHUNKS; x++) {
-			const Std::list<Item *> *list = curmap->getItemList(x, y);
+			const Std::vector<Item *> *list = curmap->getItemList(x, y);
 
 			// Should iterate the items!
 			// (items could extend outside of this chunk and they have height)
@@ -820,6 +825,20 @@ bool Debugger::cmdDecrementSortOrder(int argc, const char **argv) {
 	return false;
 }
 
+bool Debugger::cmdSortStats(int argc, const char **argv) {
+	GameMapGump *gump = Ultima8Engine::get_instance()->getGameMapGump();
+	if (!gump) {
+		debugPrintf("No game map gump\n");
+		return true;
+	}
+
+	const ItemSorter::SortStats &stats = gump->getDisplayList()->getStats();
+	uint32 pairs = stats._added > 1 ? stats._added * (stats._added - 1) / 2 : 0;
+	debugPrintf("Items: %u sorted, %u clipped, %u occluded\n", stats._added, stats._clipped, stats._occluded);
+	debugPrintf("Overlap tests: %u candidates (of %u pairs), %u overlapping\n", stats._candidates, pairs, stats._overlaps);
+	return true;
+}
+
 
 bool Debugger::cmdProcessTypes(int argc, const char **argv) {
 	Kernel::get_instance()->processTypes();
@@ -1689,6 +1708,75 @@ bool Debugger::cmdBenchmarkRenderSurface(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdBenchmarkCurrentMap(int argc, const char **argv) {
+	if (argc != 2) {
+		debugPrintf("usage: CurrentMap::benchmark iterations\n");
+		return true;
+	}
+
+	const MainActor *av = getMainActor();
+	if (!av || !av->hasExtFlags(Item::EXT_INCURMAP)) {
+		debugPrintf("Main actor is not on the map\n");
+		return true;
+	}
+
+	int count = atoi(argv[1]);
+
+	const CurrentMap *map = World::get_instance()->getCurrentMap();
+	const Point3 pt = av->getLocation();
+	const Box box = av->getWorldBox();
+	const uint32 shapeflags = av->getShapeInfo()->_flags;
+	int32 dims[3];
+	av->getFootpadWorld(dims[0], dims[1], dims[2]);
+
+	LOOPSCRIPT(script, LS_TOKEN_TRUE);
+	uint32 start, end;
+	uint32 found = 0;
+
+	start = g_system->getMillis();
+	for (int i = 0; i < count; i++) {
+		UCList uclist(2);
+		map->areaSearch(&uclist, script, sizeof(script), av, 0x300, false);
+		found += uclist.getSize();
+	}
+	end = g_system->getMillis();
+	debugPrintf("areaSearch: %d (%u items)\n", end - start, found);
+
+	found = 0;
+	start = g_system->getMillis();
+	for (int i = 0; i < count; i++) {
+		UCList uclist(2);
+		map->surfaceSearch(&uclist, script, sizeof(script), av, true, true);
+		found += uclist.getSize();
+	}
+	end = g_system->getMillis();
+	debugPrintf("surfaceSearch: %d (%u items)\n", end - start, found);
+
+	found = 0;
+	start = g_system->getMillis();
+	for (int i = 0; i < count; i++) {
+		PositionInfo info = map->getPositionInfo(box, box, shapeflags, av->getObjId());
+		found += info.valid ? 1 : 0;
+	}
+	end = g_system->getMillis();
+	debugPrintf("getPositionInfo: %d (%u valid)\n", end - start, found);
+
+	// Sweep two chunks out along each of the diagonals
+	const int32 dist = map->getChunkSize() * 2;
+	found = 0;
+	start = g_system->getMillis();
+	for (int i = 0; i < count; i++) {
+		Point3 dest(pt.x + ((i & 1) ? dist : -dist), pt.y + ((i & 2) ? dist : -dist), pt.z);
+		Std::list<CurrentMap::SweepItem> hit;
+		map->sweepTest(pt, dest, dims, shapeflags, av->getObjId(), false, &hit);
+		found += hit.size();
+	}
+	end = g_system->getMillis();
+	debugPrintf("sweepTest: %d (%u hits)\n", end - start, found);
+
+	return true;
+}
+
 bool Debugger::cmdVisualDebugPathfinder(int argc, const char **argv) {
 #ifdef DEBUG_PATHFINDER
 	if (argc != 2) {
@@ -76,6 +76,7 @@ private:
 	bool cmdDumpAllMaps(int argc, const char **argv);
 	bool cmdIncrementSortOrder(int argc, const char **argv);
 	bool cmdDecrementSortOrder(int argc, const char **argv);
+	bool cmdSortStats(int argc, const char **argv);
 
 	// Kernel
 	bool cmdProcessTypes(int argc, const char **argv);
@@ -148,6 +149,7 @@ private:
 	bool cmdPlayMovie(int argc, const char **argv);
 	bool cmdPlayMusic(int argc, const char **argv);
 	bool cmdBenchmarkRenderSurface(int argc, const char **argv);
+	bool cmdBenchmarkCurrentMap(int argc, const char **argv);
 	bool cmdVisualDebugPathfinder(int argc, const char **argv);
 
 	void dumpCurrentMap(); // helper function
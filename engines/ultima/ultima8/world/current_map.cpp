@@ -46,13 +46,14 @@
 namespace Ultima {
 namespace Ultima8 {
 
-typedef Std::list<Item *> item_list;
+typedef Std::vector<Item *> item_list;
 
 const int INT_MAX_VALUE = 0x7fffffff;
 const int INT_MIN_VALUE = -INT_MAX_VALUE - 1;
 
 CurrentMap::CurrentMap() : _currentMap(0), _eggHatcher(0),
-	  _fastXMin(-1), _fastYMin(-1), _fastXMax(-1), _fastYMax(-1) {
+	  _fastXMin(-1), _fastYMin(-1), _fastXMax(-1), _fastYMax(-1),
+	  _maxFootpad(-1) {
 	for (unsigned int i = 0; i < MAP_NUM_CHUNKS; i++) {
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
 	}
@@ -161,7 +162,7 @@ void CurrentMap::writeback() {
 }
 
 void CurrentMap::loadItems(const Std::list<Item *> &itemlist, bool callCacheIn) {
-	item_list::const_iterator iter;
+	Std::list<Item *>::const_iterator iter;
 	for (iter = itemlist.begin(); iter != itemlist.end(); ++iter) {
 		Item *item = *iter;
 
@@ -242,6 +243,9 @@ void CurrentMap::addItem(Item *item) {
 	int32 cx = pt.x / _mapChunkSize;
 	int32 cy = pt.y / _mapChunkSize;
 
+	if (_maxFootpad < 0)
+		calcMaxFootpad();
+
 #ifdef VALIDATE_CHUNKS
 	for (int32 ccy = 0; ccy < MAP_NUM_CHUNKS; ccy++) {
 		for (int32 ccx = 0; ccx < MAP_NUM_CHUNKS; ccx++) {
@@ -256,7 +260,11 @@ void CurrentMap::addItem(Item *item) {
 	}
 #endif
 
-	_items[cx][cy].push_front(item);
+	// Normal items go in front of the chunk and disposable or fast only ones
+	// at the end (see Item::move), as in the original. The chunk order decides
+	// the order of search results, so the insert at the front is kept. The
+	// shift only covers the items of one chunk.
+	_items[cx][cy].insert_at(0, item);
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -279,6 +287,9 @@ void CurrentMap::addItemToEnd(Item *item) {
 	int32 cx = pt.x / _mapChunkSize;
 	int32 cy = pt.y / _mapChunkSize;
 
+	if (_maxFootpad < 0)
+		calcMaxFootpad();
+
 #ifdef VALIDATE_CHUNKS
 	for (int32 ccy = 0; ccy < MAP_NUM_CHUNKS; ccy++) {
 		for (int32 ccx = 0; ccx < MAP_NUM_CHUNKS; ccx++) {
@@ -391,10 +402,6 @@ Item *CurrentMap::findBestTargetItem(int32 x, int32 y, int32 z, Direction dir, D
 
 
 void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
-	//! This might a bit too inefficient
-	// if it's really a problem we could change the item lists into sets
-	// or something, but let's see how it turns out
-
 	if (oldx < 0 || oldx >= _mapChunkSize * MAP_NUM_CHUNKS ||
 	        oldy < 0 || oldy >= _mapChunkSize * MAP_NUM_CHUNKS) {
 		//warning("Skipping item %u: out of range (%d, %d)", item->getObjId(), oldx, oldy);
@@ -404,7 +411,13 @@ void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
 	int32 cx = oldx / _mapChunkSize;
 	int32 cy = oldy / _mapChunkSize;
 
-	_items[cx][cy].remove(item);
+	item_list &items = _items[cx][cy];
+	for (uint i = 0; i < items.size(); i++) {
+		if (items[i] == item) {
+			items.remove_at(i);
+			break;
+		}
+	}
 	item->clearExtFlag(Item::EXT_INCURMAP);
 }
 
@@ -517,20 +530,21 @@ void CurrentMap::updateFastArea(const Point3 &from, const Point3 &to) {
 void CurrentMap::setChunkFast(int32 cx, int32 cy) {
 	_fast[cy][cx / 32] |= 1 << (cx & 31);
 
-	item_list::iterator iter;
-	for (iter = _items[cx][cy].begin();
-	        iter != _items[cx][cy].end(); ++iter) {
-		(*iter)->enterFastArea();
-	}
+	// Entering the fast area can add items to this chunk (glob eggs create
+	// their contents), which may reallocate the array, so it is walked by
+	// index. Items added during the walk get visited as well.
+	item_list &items = _items[cx][cy];
+	for (uint i = 0; i < items.size(); i++)
+		items[i]->enterFastArea();
 }
 
 void CurrentMap::unsetChunkFast(int32 cx, int32 cy) {
 	_fast[cy][cx / 32] &= ~(1 << (cx & 31));
 
-	item_list::iterator iter = _items[cx][cy].begin();
-	while (iter != _items[cx][cy].end()) {
-		Item *item = *iter;
-		++iter;
+	item_list &items = _items[cx][cy];
+	uint i = 0;
+	while (i < items.size()) {
+		Item *item = items[i];
 #ifdef VALIDATE_CHUNKS
 		int32 x, y, z;
 		item->getLocation(x, y, z);
@@ -540,6 +554,10 @@ void CurrentMap::unsetChunkFast(int32 cx, int32 cy) {
 		}
 #endif
 		item->leaveFastArea();  // Can destroy the item
+
+		// Only step over it if it is still in this chunk
+		if (i < items.size() && items[i] == item)
+			i++;
 	}
 }
 
@@ -550,6 +568,38 @@ inline void CurrentMap::clipMapChunks(int &minx, int &maxx, int &miny, int &maxy
 	maxy = CLIP(maxy, 0, MAP_NUM_CHUNKS - 1);
 }
 
+void CurrentMap::getChunkRange(int32 xmin, int32 ymin, int32 xmax, int32 ymax,
+							   int &minx, int &maxx, int &miny, int &maxy) const {
+	// Items are filed under the chunk of their location, which is the high
+	// x/y corner of their footpad. Nothing filed below xmin can reach the
+	// range, and nothing above xmax plus the largest footpad. The shape
+	// formats keep that below a chunk, so at most one extra chunk is added.
+	const int32 reach = MIN<int32>(_maxFootpad, _mapChunkSize);
+
+	minx = xmin / _mapChunkSize;
+	maxx = (xmax + reach) / _mapChunkSize;
+	miny = ymin / _mapChunkSize;
+	maxy = (ymax + reach) / _mapChunkSize;
+	clipMapChunks(minx, maxx, miny, maxy);
+}
+
+void CurrentMap::calcMaxFootpad() {
+	// The shape formats can't describe a footpad as wide as a chunk
+	MainShapeArchive *shapes = GameData::get_instance()->getMainShapes();
+	if (!shapes) {
+		_maxFootpad = _mapChunkSize;
+		return;
+	}
+
+	_maxFootpad = 0;
+	const ShapeInfo *si;
+	for (uint32 i = 0; (si = shapes->getShapeInfo(i)) != nullptr; i++) {
+		int32 xd, yd, zd;
+		si->getFootpadWorld(xd, yd, zd, 0);
+		_maxFootpad = MAX(_maxFootpad, MAX(xd, yd));
+	}
+}
+
 void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 							uint32 scriptsize, const Item *check, uint16 range,
 							bool recurse, int32 x, int32 y) const {
@@ -575,10 +625,11 @@ void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 	//
 	const Box searchrange(x + range, y + range, 0, xd + range * 2 + 1, yd + range * 2 + 1, INT_MAX_VALUE);
 
-	int minx = ((x - xd - range) / _mapChunkSize) - 1;
-	int maxx = ((x + range) / _mapChunkSize) + 1;
-	int miny = ((y - yd - range) / _mapChunkSize) - 1;
-	int maxy = ((y + range) / _mapChunkSize) + 1;
+	// Only the item locations need to be in range, not their footpads
+	int minx = (x - xd - range) / _mapChunkSize;
+	int maxx = (x + range) / _mapChunkSize;
+	int miny = (y - yd - range) / _mapChunkSize;
+	int maxy = (y + range) / _mapChunkSize;
 	clipMapChunks(minx, maxx, miny, maxy);
 
 	//
@@ -631,11 +682,8 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 	check->getFootpadWorld(xd, yd, zd);
 	const Box searchrange(pt.x, pt.y, pt.z, xd, yd, zd);
 
-	int minx = ((pt.x - xd) / _mapChunkSize) - 1;
-	int maxx = (pt.x / _mapChunkSize) + 1;
-	int miny = ((pt.y - yd) / _mapChunkSize) - 1;
-	int maxy = (pt.y / _mapChunkSize) + 1;
-	clipMapChunks(minx, maxx, miny, maxy);
+	int minx, maxx, miny, maxy;
+	getChunkRange(pt.x - xd, pt.y - yd, pt.x, pt.y, minx, maxx, miny, maxy);
 
 	for (int cy = miny; cy <= maxy; cy++) {
 		for (int cx = minx; cx <= maxx; cx++) {
@@ -650,6 +698,12 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 				if (item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
 
+				// quick reject on location before looking at the footpad
+				Point3 ipt = item->getLocation();
+				if (ipt.x <= pt.x - xd || ipt.x - _maxFootpad >= pt.x ||
+					ipt.y <= pt.y - yd || ipt.y - _maxFootpad >= pt.y)
+					continue;
+
 				// check if item is in range?
 				const Box ib = item->getWorldBox();
 				if (searchrange.overlapsXY(ib)) {
@@ -699,7 +753,7 @@ TeleportEgg *CurrentMap::findDestination(uint16 id) {
 	return nullptr;
 }
 
-const Std::list<Item *> *CurrentMap::getItemList(int32 gx, int32 gy) const {
+const Std::vector<Item *> *CurrentMap::getItemList(int32 gx, int32 gy) const {
 	if (gx < 0 || gy < 0 || gx >= MAP_NUM_CHUNKS || gy >= MAP_NUM_CHUNKS)
 		return nullptr;
 	return &_items[gx][gy];
@@ -730,11 +784,11 @@ PositionInfo CurrentMap::getPositionInfo(const Box &target, const Box &start, ui
 	int32 midx = target._x - target._xd / 2;
 	int32 midy = target._y - target._yd / 2;
 
-	int minx = ((target._x - target._xd) / _mapChunkSize) - 1;
-	int maxx = (target._x / _mapChunkSize) + 1;
-	int miny = ((target._y - target._yd) / _mapChunkSize) - 1;
-	int maxy = (target._y / _mapChunkSize) + 1;
-	clipMapChunks(minx, maxx, miny, maxy);
+	const int32 xmin = target._x - target._xd;
+	const int32 ymin = target._y - target._yd;
+
+	int minx, maxx, miny, maxy;
+	getChunkRange(xmin, ymin, target._x, target._y, minx, maxx, miny, maxy);
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
@@ -747,6 +801,12 @@ PositionInfo CurrentMap::getPositionInfo(const Box &target, const Box &start, ui
 				if (item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
 
+				// quick reject on location before looking at the footpad
+				Point3 pt = item->getLocation();
+				if (pt.x < xmin || pt.x - _maxFootpad >= target._x ||
+					pt.y < ymin || pt.y - _maxFootpad >= target._y)
+					continue;
+
 				const ShapeInfo *si = item->getShapeInfo();
 				if (!(si->_flags & flagmask))
 					continue; // not an interesting item
@@ -986,27 +1046,16 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 						   Std::list<SweepItem> *hit) const {
 	const uint32 blockflagmask = (ShapeInfo::SI_SOLID | ShapeInfo::SI_DAMAGING | ShapeInfo::SI_LAND);
 
-	int minx = ((start.x - dims[0]) / _mapChunkSize) - 1;
-	int maxx = (start.x / _mapChunkSize) + 1;
-	int miny = ((start.y - dims[1]) / _mapChunkSize) - 1;
-	int maxy = (start.y / _mapChunkSize) + 1;
-
-	{
-		int dminx = ((end.x - dims[0]) / _mapChunkSize) - 1;
-		int dmaxx = (end.x / _mapChunkSize) + 1;
-		int dminy = ((end.y - dims[1]) / _mapChunkSize) - 1;
-		int dmaxy = (end.y / _mapChunkSize) + 1;
-		if (dminx < minx)
-			minx = dminx;
-		if (dmaxx > maxx)
-			maxx = dmaxx;
-		if (dminy < miny)
-			miny = dminy;
-		if (dmaxy > maxy)
-			maxy = dmaxy;
-	}
+	// The x/y range swept by the item. Pad it a little, as items which
+	// merely touch the swept box are reported too and the overlap tests
+	// below work on rounded half extents.
+	const int32 sweepXMin = MIN(start.x, end.x) - dims[0] - 2;
+	const int32 sweepXMax = MAX(start.x, end.x) + 2;
+	const int32 sweepYMin = MIN(start.y, end.y) - dims[1] - 2;
+	const int32 sweepYMax = MAX(start.y, end.y) + 2;
 
-	clipMapChunks(minx, maxx, miny, maxy);
+	int minx, maxx, miny, maxy;
+	getChunkRange(sweepXMin, sweepYMin, sweepXMax, sweepYMax, minx, maxx, miny, maxy);
 
 	// Get velocity, extents, and centre of item
 	int32 vel[3];
@@ -1045,6 +1094,12 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 				if (other_item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
 
+				// quick reject on location before looking at the footpad
+				Point3 opt = other_item->getLocation();
+				if (opt.x < sweepXMin || opt.x - _maxFootpad > sweepXMax ||
+					opt.y < sweepYMin || opt.y - _maxFootpad > sweepYMax)
+					continue;
+
 				uint32 othershapeflags = other_item->getShapeInfo()->_flags;
 				bool blocking = (othershapeflags & shapeflags &
 				                 blockflagmask) != 0;
@@ -1055,7 +1110,6 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 					continue;
 
 				int32 other[3], oext[3];
-				Point3 opt = other_item->getLocation();
 				other[0] = opt.x;
 				other[1] = opt.y;
 				other[2] = opt.z;
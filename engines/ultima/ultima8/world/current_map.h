@@ -172,7 +172,7 @@ public:
 	TeleportEgg *findDestination(uint16 id);
 
 	// Not allowed to modify the list. Remember to use const_iterator
-	const Std::list<Item *> *getItemList(int32 gx, int32 gy) const;
+	const Std::vector<Item *> *getItemList(int32 gx, int32 gy) const;
 
 	bool isChunkFast(int32 cx, int32 cy) const {
 		// CONSTANTS!
@@ -199,11 +199,19 @@ private:
 	//! clip the given map chunk numbers to iterate over them safely
 	static void clipMapChunks(int &minx, int &maxx, int &miny, int &maxy);
 
+	//! get the (clipped) map chunks holding items whose footpad can reach
+	//! the given world x/y range
+	void getChunkRange(int32 xmin, int32 ymin, int32 xmax, int32 ymax,
+	                   int &minx, int &maxx, int &miny, int &maxy) const;
+
+	//! work out the largest world footpad of any shape
+	void calcMaxFootpad();
+
 	Map *_currentMap;
 
 	// item lists. Lots of them :-)
 	// items[x][y]
-	Std::list<Item *> _items[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
+	Std::vector<Item *> _items[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
 
 	ProcId _eggHatcher;
 
@@ -213,6 +221,11 @@ private:
 
 	int _mapChunkSize;
 
+	//! Largest x or y footpad of any shape, in world coordinates. An item
+	//! sits at the high x/y corner of its footpad, so this bounds how far
+	//! below its location (and so into lower chunks) an item can reach.
+	int32 _maxFootpad;
+
 	//! Items that are "targetable" in Crusader. It might be faster to store
 	//! this in a more fancy data structure, but this works fine.
 	ObjId _targets[MAP_NUM_TARGET_ITEMS];
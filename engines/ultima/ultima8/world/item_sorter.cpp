@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "ultima/ultima.h"
 #include "ultima/ultima8/misc/common_types.h"
 #include "ultima/ultima8/world/item_sorter.h"
@@ -45,33 +46,96 @@ namespace Ultima8 {
 static const uint32 TRANSPARENT_COLOR = TEX32_PACK_RGBA(0x7F, 0x00, 0x00, 0x7F);
 static const uint32 HIGHLIGHT_COLOR = TEX32_PACK_RGBA(0xFF, 0xFF, 0x00, 0x1F);
 
+// Size in pixels of the screenspace buckets used to find overlapping items
+static const int32 GRID_CELL_SIZE = 64;
+
+// Number of SortItems allocated at once when running out of them
+static const int SORTITEM_BLOCK_SIZE = 256;
+
+// Orders items the way they appear in the _items list
+struct SortItemListOrder {
+	bool operator()(const SortItem *si1, const SortItem *si2) const {
+		if (si1->listLessThan(*si2))
+			return true;
+		if (si2->listLessThan(*si1))
+			return false;
+		return si1->_listSeq < si2->_listSeq;
+	}
+};
+
 ItemSorter::ItemSorter(int capacity) :
 	_shapes(nullptr), _clipWindow(0, 0, 0, 0), _items(nullptr), _itemsTail(nullptr),
-	_itemsUnused(nullptr), _painted(nullptr), _camSx(0), _camSy(0),
+	_itemsUnused(nullptr), _painted(nullptr), _gridWidth(0), _gridHeight(0),
+	_gridMark(0), _listSeq(0), _camSx(0), _camSy(0),
 	_sortLimit(0), _sortLimitChanged(false) {
-	int i = capacity;
-	while (i--) {
-		SortItem *next = _itemsUnused;
-		_itemsUnused = new SortItem();
-		_itemsUnused->_next = next;
-	}
+	allocateItems(capacity);
 }
 
 ItemSorter::~ItemSorter() {
-	if (_itemsTail) {
-		_itemsTail->_next = _itemsUnused;
-		_itemsUnused = _items;
-	}
 	_items = nullptr;
 	_itemsTail = nullptr;
+	_itemsUnused = nullptr;
 
-	while (_itemsUnused) {
-		SortItem *next = _itemsUnused->_next;
-		delete _itemsUnused;
-		_itemsUnused = next;
+	for (uint i = 0; i < _itemBlocks.size(); i++)
+		delete[] _itemBlocks[i];
+}
+
+void ItemSorter::allocateItems(int count) {
+	if (count <= 0)
+		return;
+
+	SortItem *block = new SortItem[count];
+	_itemBlocks.push_back(block);
+
+	for (int i = count - 1; i >= 0; i--) {
+		block[i]._next = _itemsUnused;
+		_itemsUnused = &block[i];
 	}
 }
 
+void ItemSorter::getGridRange(const Rect &r, int32 &x0, int32 &y0, int32 &x1, int32 &y1) const {
+	// Rects reaching outside the clip window are clamped to the border
+	// cells, which keeps every pair of intersecting rects in a common cell
+	x0 = CLIP<int32>((r.left - _clipWindow.left) / GRID_CELL_SIZE, 0, _gridWidth - 1);
+	y0 = CLIP<int32>((r.top - _clipWindow.top) / GRID_CELL_SIZE, 0, _gridHeight - 1);
+	x1 = CLIP<int32>((MAX(r.left, r.right - 1) - _clipWindow.left) / GRID_CELL_SIZE, 0, _gridWidth - 1);
+	y1 = CLIP<int32>((MAX(r.top, r.bottom - 1) - _clipWindow.top) / GRID_CELL_SIZE, 0, _gridHeight - 1);
+}
+
+void ItemSorter::addToGrid(SortItem *si) {
+	int32 x0, y0, x1, y1;
+	getGridRange(si->_sr, x0, y0, x1, y1);
+
+	for (int32 y = y0; y <= y1; y++) {
+		for (int32 x = x0; x <= x1; x++)
+			_grid[y * _gridWidth + x].push_back(si);
+	}
+}
+
+void ItemSorter::gatherCandidates(const Rect &r) {
+	_candidates.resize(0);
+	_gridMark++;
+
+	int32 x0, y0, x1, y1;
+	getGridRange(r, x0, y0, x1, y1);
+
+	for (int32 y = y0; y <= y1; y++) {
+		for (int32 x = x0; x <= x1; x++) {
+			const Common::Array<SortItem *> &cell = _grid[y * _gridWidth + x];
+			for (uint i = 0; i < cell.size(); i++) {
+				SortItem *si = cell[i];
+				if (si->_gridMark != _gridMark) {
+					si->_gridMark = _gridMark;
+					_candidates.push_back(si);
+				}
+			}
+		}
+	}
+
+	Common::sort(_candidates.begin(), _candidates.end(), SortItemListOrder());
+	_stats._candidates += _candidates.size();
+}
+
 void ItemSorter::BeginDisplayList(const Rect &clipWindow, const Point3 &cam) {
 	// Get the _shapes, if required
 	if (!_shapes) _shapes = GameData::get_instance()->getMainShapes();
@@ -88,6 +152,17 @@ void ItemSorter::BeginDisplayList(const Rect &clipWindow, const Point3 &cam) {
 	_itemsTail = nullptr;
 	_painted = nullptr;
 
+	// Reset the grid, keeping the memory of its cells
+	_gridWidth = MAX<int32>(1, (clipWindow.width() + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+	_gridHeight = MAX<int32>(1, (clipWindow.height() + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+	if (_grid.size() < (uint)(_gridWidth * _gridHeight))
+		_grid.resize(_gridWidth * _gridHeight);
+	for (uint i = 0; i < _grid.size(); i++)
+		_grid[i].resize(0);
+	_listSeq = 0;
+
+	_stats = SortStats();
+
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	int32 camSx = (cam.x - cam.y) / 4;
 	// Screenspace bounding box bottom extent  (RNB y coord)
@@ -106,7 +181,7 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 
 	// First thing, get a SortItem to use (first of unused)
 	if (!_itemsUnused)
-		_itemsUnused = new SortItem();
+		allocateItems(SORTITEM_BLOCK_SIZE);
 	SortItem *si = _itemsUnused;
 
 	si->_itemNum = itemNum;
@@ -154,6 +229,7 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	// Do Clipping here
 	if (!_clipWindow.intersects(si->_sr)) {
 		// Clipped away entirely - don't add to the list.
+		_stats._clipped++;
 		return;
 	}
 
@@ -187,14 +263,19 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
+	// Compare _shapes with the items that may overlap, in list order
 
-	// Ok,
-	SortItem *addpoint = nullptr;
-	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
-		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->listLessThan(*si2))
-			addpoint = si2;
+#ifdef SORTITEM_OCCLUSION_EXPERIMENTAL
+	// Items sharing an edge only touch in screenspace
+	Rect area = si->_sr;
+	area.grow(1);
+	gatherCandidates(area);
+#else
+	gatherCandidates(si->_sr);
+#endif
+
+	for (uint i = 0; i < _candidates.size(); i++) {
+		SortItem *si2 = _candidates[i];
 
 		if (si2->_occluded)
 			continue;
@@ -222,10 +303,12 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 
 		// Attempt to find paint dependency order
 		if (si->overlap(*si2)) {
+			_stats._overlaps++;
 			if (si->below(*si2)) {
 				if (si2->_occl && si2->occludes(*si)) {
 					// No need to do any more checks, this isn't visible
 					si->_occluded = true;
+					_stats._occluded++;
 					break;
 				} else {
 					// si1 is behind si2, so add it to si2's dependency list
@@ -235,6 +318,7 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 				if (si->_occl && si->occludes(*si2)) {
 					// Occluded, but we can't remove it from the list
 					si2->_occluded = true;
+					_stats._occluded++;
 				} else {
 					// si2 is behind si1, so add it to si1's dependency list
 					si->_depends.insert_sorted(si2);
@@ -243,8 +327,16 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 		}
 	}
 
+	// Get the insert point... which is before the first item that has higher z than us
+	SortItem *addpoint = nullptr;
+	for (SortItem *si2 = _itemsTail; si2 != nullptr && si->listLessThan(*si2); si2 = si2->_prev)
+		addpoint = si2;
+
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
+	si->_listSeq = _listSeq++;
+	addToGrid(si);
+	_stats._added++;
 
 	// have a position
 	//addpoint = 0;
@@ -354,7 +446,9 @@ void ItemSorter::PaintDisplayList(RenderSurface *surf, bool item_highlight, bool
 
 				oc.setBoxBounds(box, _camSx, _camSy);
 
-				for (si2 = _items; si2 != nullptr; si2 = si2->_next) {
+				gatherCandidates(oc._sr);
+				for (uint i = 0; i < _candidates.size(); i++) {
+					si2 = _candidates[i];
 					if (si2->_groupNum != group && !si2->_occluded &&
 						si2->overlap(oc) && si2->below(oc) && oc.occludes(*si2)) {
 						si2->_occluded = true;
@@ -22,6 +22,7 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "common/array.h"
 #include "ultima/ultima8/misc/rect.h"
 
 namespace Ultima {
@@ -34,6 +35,19 @@ struct SortItem;
 struct Point3;
 
 class ItemSorter {
+public:
+	// Counters of the last display list, for the debugger
+	struct SortStats {
+		uint32 _added;       // Items in the display list
+		uint32 _clipped;     // Items outside the clip window
+		uint32 _candidates;  // Items sharing a grid cell with a new item
+		uint32 _overlaps;    // Candidates actually overlapping a new item
+		uint32 _occluded;    // Items found hidden behind another one
+
+		SortStats() : _added(0), _clipped(0), _candidates(0), _overlaps(0), _occluded(0) {}
+	};
+
+private:
 	MainShapeArchive    *_shapes;
 	Rect        _clipWindow;
 
@@ -42,6 +56,19 @@ class ItemSorter {
 	SortItem    *_itemsUnused;
 	SortItem    *_painted;
 
+	// SortItems are allocated in blocks and recycled through _itemsUnused
+	Common::Array<SortItem *> _itemBlocks;
+
+	// Screenspace buckets of the items added so far, so overlap tests
+	// only have to look at items near the new one
+	Common::Array<Common::Array<SortItem *> > _grid;
+	int32       _gridWidth, _gridHeight;
+	uint32      _gridMark;
+	uint32      _listSeq;
+	Common::Array<SortItem *> _candidates;
+
+	SortStats   _stats;
+
 	int32       _camSx, _camSy;
 	int32       _sortLimit;
 	bool        _sortLimitChanged;
@@ -69,8 +96,19 @@ public:
 
 	void IncSortLimit(int count);
 
+	const SortStats &getStats() const {
+		return _stats;
+	}
+
 private:
 	bool PaintSortItem(RenderSurface *surf, SortItem *si, bool showFootpad);
+
+	void allocateItems(int count);
+
+	// Collect the items whose screenspace rect may intersect r, in list order
+	void gatherCandidates(const Rect &r);
+	void addToGrid(SortItem *si);
+	void getGridRange(const Rect &r, int32 &x0, int32 &y0, int32 &x1, int32 &y1) const;
 };
 
 } // End of namespace Ultima8
@@ -51,7 +51,8 @@ BaseRenderer *makeOSystemRenderer(BaseGame *inGame) {
 BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_renderSurface = new Graphics::Surface();
 	_blankSurface = new Graphics::Surface();
-	_lastFrameIter = _renderQueue.end();
+	_lastFrameFirst = 0;
+	_lastFrameIndexed = false;
 	_needsFlip = true;
 	_skipThisFrame = false;
 
@@ -68,11 +69,14 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 //////////////////////////////////////////////////////////////////////////
 BaseRenderOSystem::~BaseRenderOSystem() {
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+	for (uint32 i = 0; i < _renderQueue.size(); i++) {
+		delete _renderQueue[i];
+	}
+	for (uint32 i = 0; i < _lastFrameQueue.size(); i++) {
+		delete _lastFrameQueue[i];
+	}
+	for (uint32 i = 0; i < _ticketPool.size(); i++) {
+		delete _ticketPool[i];
 	}
 
 	delete _dirtyRect;
@@ -164,11 +168,10 @@ bool BaseRenderOSystem::flip() {
 		_needsFlip = false;
 
 		// Reset ticketing state
-		_lastFrameIter = _renderQueue.end();
-		RenderQueueIterator it;
-		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-			(*it)->_wantsDraw = false;
+		for (uint32 i = 0; i < _renderQueue.size(); i++) {
+			_renderQueue[i]->_wantsDraw = false;
 		}
+		startTicketFrame();
 
 		addDirtyRect(_renderRect);
 		return true;
@@ -177,17 +180,15 @@ bool BaseRenderOSystem::flip() {
 		drawTickets();
 	} else {
 		// Clear the scale-buffered tickets that wasn't reused.
-		RenderQueueIterator it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			if ((*it)->_wantsDraw == false) {
-				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
-				delete ticket;
-			} else {
-				(*it)->_wantsDraw = false;
-				++it;
+		for (uint32 i = _lastFrameFirst; i < _lastFrameQueue.size(); i++) {
+			if (_lastFrameQueue[i]) {
+				releaseTicket(_lastFrameQueue[i]);
 			}
 		}
+		_lastFrameQueue.resize(0);
+		for (uint32 i = 0; i < _renderQueue.size(); i++) {
+			_renderQueue[i]->_wantsDraw = false;
+		}
 	}
 
 	int oldScreenChangeID = _lastScreenChangeID;
@@ -203,7 +204,7 @@ bool BaseRenderOSystem::flip() {
 		_dirtyRect = nullptr;
 		_needsFlip = false;
 	}
-	_lastFrameIter = _renderQueue.end();
+	startTicketFrame();
 
 	g_system->updateScreen();
 
@@ -288,7 +289,7 @@ Graphics::PixelFormat BaseRenderOSystem::getPixelFormat() const {
 void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
                                     Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
 	if (_disableDirtyRects) {
-		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+		RenderTicket *ticket = createTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
 		drawFromSurface(ticket);
@@ -302,32 +303,79 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
+		int32 index = findLastFrameTicket(compare);
+		if (index >= 0) {
+			drawFromQueuedTicket((uint32)index);
+			return;
+		}
+	}
+	RenderTicket *ticket = createTicket(owner, surf, srcRect, dstRect, transform);
+	drawFromTicket(ticket);
+}
+
+RenderTicket *BaseRenderOSystem::createTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
+                                              Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
+	if (_ticketPool.empty()) {
+		return new RenderTicket(owner, surf, srcRect, dstRect, transform);
+	}
+
+	RenderTicket *ticket = _ticketPool.back();
+	_ticketPool.pop_back();
+	ticket->reset(owner, surf, srcRect, dstRect, transform);
+	return ticket;
+}
+
+void BaseRenderOSystem::releaseTicket(RenderTicket *ticket) {
+	_ticketPool.push_back(ticket);
+}
+
+int32 BaseRenderOSystem::findLastFrameTicket(const RenderTicket &compare) {
+	if (!_lastFrameIndexed) {
+		// Chain the tickets sharing a hash in queue order, walking it
+		// backwards so every new one becomes the head of its chain
+		_lastFrameIndex.clear();
+		_lastFrameNext.resize(_lastFrameQueue.size());
+		for (int32 i = (int32)_lastFrameQueue.size() - 1; i >= (int32)_lastFrameFirst; i--) {
+			if (!_lastFrameQueue[i]) {
+				continue;
+			}
+			uint32 hash = _lastFrameQueue[i]->getHash();
+			Common::HashMap<uint32, uint32>::iterator head = _lastFrameIndex.find(hash);
+			if (head != _lastFrameIndex.end()) {
+				_lastFrameNext[i] = head->_value;
+				head->_value = i;
+			} else {
+				_lastFrameNext[i] = (uint32)-1;
+				_lastFrameIndex[hash] = i;
 			}
 		}
+		_lastFrameIndexed = true;
 	}
-	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
-	if (!_disableDirtyRects) {
-		drawFromTicket(ticket);
-	} else {
-		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
-		drawFromSurface(ticket);
+
+	Common::HashMap<uint32, uint32>::const_iterator head = _lastFrameIndex.find(compare.getHash());
+	if (head == _lastFrameIndex.end()) {
+		return -1;
+	}
+
+	for (uint32 i = head->_value; i != (uint32)-1; i = _lastFrameNext[i]) {
+		RenderTicket *compareTicket = _lastFrameQueue[i];
+		if (compareTicket && *(compareTicket) == compare && compareTicket->_isValid) {
+			return (int32)i;
+		}
+	}
+	return -1;
+}
+
+void BaseRenderOSystem::startTicketFrame() {
+	for (uint32 i = _lastFrameFirst; i < _lastFrameQueue.size(); i++) {
+		if (_lastFrameQueue[i]) {
+			_renderQueue.push_back(_lastFrameQueue[i]);
+		}
 	}
+	_lastFrameQueue.swap(_renderQueue);
+	_renderQueue.resize(0);
+	_lastFrameFirst = 0;
+	_lastFrameIndexed = false;
 }
 
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
@@ -337,47 +385,41 @@ void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 }
 
 void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
-	RenderQueueIterator it;
-	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-		if ((*it)->_owner == surf) {
-			invalidateTicket(*it);
+	for (uint32 i = 0; i < _renderQueue.size(); i++) {
+		if (_renderQueue[i]->_owner == surf) {
+			invalidateTicket(_renderQueue[i]);
+		}
+	}
+	for (uint32 i = _lastFrameFirst; i < _lastFrameQueue.size(); i++) {
+		if (_lastFrameQueue[i] && _lastFrameQueue[i]->_owner == surf) {
+			invalidateTicket(_lastFrameQueue[i]);
 		}
 	}
 }
 
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	renderTicket->_wantsDraw = true;
-
-	++_lastFrameIter;
-	// In-order
-	if (_renderQueue.empty() || _lastFrameIter == _renderQueue.end()) {
-		_lastFrameIter--;
-		_renderQueue.push_back(renderTicket);
-		++_lastFrameIter;
-		addDirtyRect(renderTicket->_dstRect);
-	} else {
-		// Before something
-		RenderQueueIterator pos = _lastFrameIter;
-		_renderQueue.insert(pos, renderTicket);
-		--_lastFrameIter;
-		addDirtyRect(renderTicket->_dstRect);
-	}
+	_renderQueue.push_back(renderTicket);
+	addDirtyRect(renderTicket->_dstRect);
 }
 
-void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket) {
-	RenderTicket *renderTicket = *ticket;
+void BaseRenderOSystem::drawFromQueuedTicket(uint32 index) {
+	RenderTicket *renderTicket = _lastFrameQueue[index];
 	assert(!renderTicket->_wantsDraw);
-	renderTicket->_wantsDraw = true;
+	_lastFrameQueue[index] = nullptr;
+
+	while (_lastFrameFirst < index && !_lastFrameQueue[_lastFrameFirst]) {
+		++_lastFrameFirst;
+	}
 
-	++_lastFrameIter;
 	// Not in the same order?
-	if (*_lastFrameIter != renderTicket) {
-		--_lastFrameIter;
-		// Remove the ticket from the list
-		assert(*_lastFrameIter != renderTicket);
-		_renderQueue.erase(ticket);
+	if (index != _lastFrameFirst) {
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
+	} else {
+		renderTicket->_wantsDraw = true;
+		_renderQueue.push_back(renderTicket);
+		++_lastFrameFirst;
 	}
 }
 
@@ -391,39 +433,33 @@ void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
 }
 
 void BaseRenderOSystem::drawTickets() {
-	RenderQueueIterator it = _renderQueue.begin();
 	// Clean out the old tickets
 	// Note: We draw invalid tickets too, otherwise we wouldn't be honoring
 	// the draw request they obviously made BEFORE becoming invalid, either way
 	// we have a copy of their data, so their invalidness won't affect us.
-	while (it != _renderQueue.end()) {
-		if ((*it)->_wantsDraw == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
-		} else {
-			++it;
+	for (uint32 i = _lastFrameFirst; i < _lastFrameQueue.size(); i++) {
+		RenderTicket *ticket = _lastFrameQueue[i];
+		if (ticket) {
+			addDirtyRect(ticket->_dstRect);
+			releaseTicket(ticket);
 		}
 	}
+	_lastFrameQueue.resize(0);
+	_lastFrameFirst = 0;
+
 	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
-		it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			RenderTicket *ticket = *it;
-			ticket->_wantsDraw = false;
-			++it;
+		for (uint32 i = 0; i < _renderQueue.size(); i++) {
+			_renderQueue[i]->_wantsDraw = false;
 		}
 		return;
 	}
 
-	it = _renderQueue.begin();
-	_lastFrameIter = _renderQueue.end();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+	if (_renderQueue.size() == 1 && _renderQueue[0]->_transform._alphaDisable == true) {
 		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		if (*_dirtyRect != _renderQueue[0]->_dstRect) {
 			// Apply the clear-color to the dirty rect.
 			_renderSurface->fillRect(*_dirtyRect, _clearColor);
 		}
@@ -432,41 +468,50 @@ void BaseRenderOSystem::drawTickets() {
 		// Apply the clear-color to the dirty rect.
 		_renderSurface->fillRect(*_dirtyRect, _clearColor);
 	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
+
+	// Clip every ticket against the dirty rect first, then do all the
+	// blits in a row, in queue order as the blending depends on it.
+	_blitBatch.resize(0);
+	for (uint32 i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
 		if (ticket->_dstRect.intersects(*_dirtyRect)) {
+			BlitCommand command;
+			command.ticket = ticket;
 			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
+			command.clip = ticket->_dstRect;
 			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
+			command.clip.clip(*_dirtyRect);
 			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
+			command.pos = command.clip;
 			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+			command.clip.translate(-ticket->_dstRect.left, -ticket->_dstRect.top);
+			_blitBatch.push_back(command);
 		}
 		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
 		ticket->_wantsDraw = false;
 	}
+
+	for (uint32 i = 0; i < _blitBatch.size(); i++) {
+		drawFromSurface(_blitBatch[i].ticket, &_blitBatch[i].pos, &_blitBatch[i].clip);
+	}
+	if (!_blitBatch.empty()) {
+		_needsFlip = true;
+	}
+
 	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
-	it = _renderQueue.begin();
 	// Clean out the old tickets
-	while (it != _renderQueue.end()) {
-		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
+	uint32 kept = 0;
+	for (uint32 i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
+		if (ticket->_isValid == false) {
+			addDirtyRect(ticket->_dstRect);
+			releaseTicket(ticket);
 		} else {
-			++it;
+			_renderQueue[kept++] = ticket;
 		}
 	}
-
+	_renderQueue.resize(kept);
 }
 
 // Replacement for SDL2's SDL_RenderCopy
@@ -582,16 +627,20 @@ void BaseRenderOSystem::endSaveLoad() {
 	BaseRenderer::endSaveLoad();
 
 	// Clear the scale-buffered tickets as we just loaded.
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+	for (uint32 i = 0; i < _renderQueue.size(); i++) {
+		releaseTicket(_renderQueue[i]);
+	}
+	_renderQueue.resize(0);
+	for (uint32 i = _lastFrameFirst; i < _lastFrameQueue.size(); i++) {
+		if (_lastFrameQueue[i]) {
+			releaseTicket(_lastFrameQueue[i]);
+		}
 	}
+	_lastFrameQueue.resize(0);
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
-	_lastFrameIter = _renderQueue.end();
+	startTicketFrame();
 
 	_renderSurface->fillRect(Common::Rect(0, 0, _renderSurface->w, _renderSurface->h), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
 	g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
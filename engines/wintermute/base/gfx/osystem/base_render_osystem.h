@@ -30,8 +30,9 @@
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
 
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/rect.h"
-#include "common/list.h"
 
 #include "graphics/surface.h"
 #include "graphics/transform_struct.h"
@@ -54,6 +55,11 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * The tickets of last frame are kept in draw order in a flat array, and indexed
+ * by the hash of their arguments, so finding the one matching an incoming call
+ * doesn't require walking the queue. Tickets are recycled between frames
+ * together with their pixel buffers.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accommodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -63,8 +69,6 @@ public:
 	BaseRenderOSystem(BaseGame *inGame);
 	~BaseRenderOSystem() override;
 
-	typedef Common::List<RenderTicket *>::iterator RenderQueueIterator;
-
 	Common::String getName() const override;
 
 	bool initRenderer(int width, int height, bool windowed) override;
@@ -92,9 +96,9 @@ public:
 	/**
 	 * Re-insert an existing ticket into the queue, adding a dirty rect
 	 * out-of-order from last draw from the ticket.
-	 * @param ticket iterator pointing to the ticket to be added.
+	 * @param index position of the ticket in last frame's queue.
 	 */
-	void drawFromQueuedTicket(const RenderQueueIterator &ticket);
+	void drawFromQueuedTicket(uint32 index);
 
 	bool setViewport(int left, int top, int right, int bottom) override;
 	bool setViewport(Rect32 *rect) override { return BaseRenderer::setViewport(rect); }
@@ -126,15 +130,44 @@ private:
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Find the first ticket from last frame that wasn't reused yet and
+	 * matches the draw-call, returns -1 if there is none.
+	 */
+	int32 findLastFrameTicket(const RenderTicket &compare);
+	/**
+	 * Make this frame's tickets, followed by the ones of last frame that
+	 * weren't reused, the reference for the next frame.
+	 */
+	void startTicketFrame();
+	RenderTicket *createTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
+	void releaseTicket(RenderTicket *ticket);
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
 	Common::Rect *_dirtyRect;
-	Common::List<RenderTicket *> _renderQueue;
+	// This frame's tickets, in draw order
+	Common::Array<RenderTicket *> _renderQueue;
+	// Last frame's tickets, nullptr once reused
+	Common::Array<RenderTicket *> _lastFrameQueue;
+	// Everything before this index in _lastFrameQueue was reused
+	uint32 _lastFrameFirst;
+	// Ticket hash -> first index in _lastFrameQueue, and from each index
+	// to the next one with the same hash
+	Common::HashMap<uint32, uint32> _lastFrameIndex;
+	Common::Array<uint32> _lastFrameNext;
+	bool _lastFrameIndexed;
+	Common::Array<RenderTicket *> _ticketPool;
+
+	struct BlitCommand {
+		RenderTicket *ticket;
+		Common::Rect pos;
+		Common::Rect clip;
+	};
+	Common::Array<BlitCommand> _blitBatch;
 
 	bool _needsFlip;
-	RenderQueueIterator _lastFrameIter;
 	Common::Rect _renderRect;
 	Graphics::Surface *_renderSurface;
 	Graphics::Surface *_blankSurface;
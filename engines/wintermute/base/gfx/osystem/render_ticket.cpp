@@ -36,21 +36,46 @@
 
 namespace Wintermute {
 
+static inline uint32 packPoint(int16 x, int16 y) {
+	return ((uint32)(uint16)x << 16) | (uint16)y;
+}
+
 RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
-                           Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) :
-	        _owner(owner),
-	        _srcRect(*srcRect),
-	        _dstRect(*dstRect),
-	        _isValid(true),
-	        _wantsDraw(true),
-	        _transform(transform) {
+                           Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) {
+	reset(owner, surf, srcRect, dstRect, transform);
+}
+
+RenderTicket::~RenderTicket() {
+	_surface.free();
+}
+
+void RenderTicket::reset(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
+                         Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) {
+	_owner = owner;
+	_srcRect = *srcRect;
+	_dstRect = *dstRect;
+	_isValid = true;
+	_wantsDraw = true;
+	_transform = transform;
+
+	_hash = (uint32)(uintptr)owner;
+	_hash = _hash * 31 + packPoint(_dstRect.left, _dstRect.top);
+	_hash = _hash * 31 + packPoint(_dstRect.right, _dstRect.bottom);
+	_hash = _hash * 31 + packPoint(_srcRect.left, _srcRect.top);
+	_hash = _hash * 31 + packPoint(_srcRect.right, _srcRect.bottom);
+	_hash = _hash * 31 + packPoint(_transform._zoom.x, _transform._zoom.y);
+	_hash = _hash * 31 + (uint32)_transform._angle;
+	_hash = _hash * 31 + _transform._rgbaMod;
+	_hash = _hash * 31 + (uint32)((_transform._flip << 8) | (_transform._blendMode << 1) | (_transform._alphaDisable ? 1 : 0));
+
 	if (surf) {
-		_surface = new Graphics::Surface();
-		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
-		assert(_surface->format.bytesPerPixel == 4);
+		if (_surface.w != srcRect->width() || _surface.h != srcRect->height() || _surface.format != surf->format) {
+			_surface.create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
+		}
+		assert(_surface.format.bytesPerPixel == 4);
 		// Get a clipped copy of the surface
-		for (int i = 0; i < _surface->h; i++) {
-			memcpy(_surface->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * _surface->format.bytesPerPixel);
+		for (int i = 0; i < _surface.h; i++) {
+			memcpy(_surface.getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * _surface.format.bytesPerPixel);
 		}
 		// Then scale it if necessary
 		//
@@ -61,27 +86,20 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
 		if (_transform._angle != Graphics::kDefaultAngle) {
-			Graphics::Surface *temp = _surface->rotoscale(transform, owner->_gameRef->getBilinearFiltering());
-			_surface->free();
-			delete _surface;
-			_surface = temp;
+			Graphics::Surface *temp = _surface.rawSurface().rotoscale(transform, owner->_gameRef->getBilinearFiltering());
+			_surface.copyFrom(*temp);
+			temp->free();
+			delete temp;
 		} else if ((dstRect->width() != srcRect->width() ||
 					dstRect->height() != srcRect->height()) &&
 					_transform._numTimesX * _transform._numTimesY == 1) {
-			Graphics::Surface *temp = _surface->scale(dstRect->width(), dstRect->height(), owner->_gameRef->getBilinearFiltering());
-			_surface->free();
-			delete _surface;
-			_surface = temp;
+			Graphics::Surface *temp = _surface.rawSurface().scale(dstRect->width(), dstRect->height(), owner->_gameRef->getBilinearFiltering());
+			_surface.copyFrom(*temp);
+			temp->free();
+			delete temp;
 		}
 	} else {
-		_surface = nullptr;
-	}
-}
-
-RenderTicket::~RenderTicket() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
+		_surface.free();
 	}
 }
 
@@ -96,26 +114,26 @@ bool RenderTicket::operator==(const RenderTicket &t) const {
 	return true;
 }
 
-// Replacement for SDL2's SDL_RenderCopy
-void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
-	Graphics::ManagedSurface src;
-	src.copyFrom(*getSurface());
+Graphics::AlphaType RenderTicket::getAlphaType() const {
+	if (!_owner) {
+		return Graphics::ALPHA_FULL;
+	}
+	if (_transform._alphaDisable) {
+		return Graphics::ALPHA_OPAQUE;
+	}
+	if (_transform._angle) {
+		return Graphics::ALPHA_FULL;
+	}
+	return _owner->getAlphaType();
+}
 
+// Replacement for SDL2's SDL_RenderCopy
+void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) {
 	Common::Rect clipRect;
-	clipRect.setWidth(getSurface()->w);
-	clipRect.setHeight(getSurface()->h);
-
-	Graphics::AlphaType alphaMode = Graphics::ALPHA_FULL;
-
-	if (_owner) {
-		if (_transform._alphaDisable) {
-			alphaMode = Graphics::ALPHA_OPAQUE;
-		} else if (_transform._angle) {
-			alphaMode = Graphics::ALPHA_FULL;
-		} else {
-			alphaMode = _owner->getAlphaType();
-		}
-	}
+	clipRect.setWidth(_surface.w);
+	clipRect.setHeight(_surface.h);
+
+	Graphics::AlphaType alphaMode = getAlphaType();
 
 	int y = _dstRect.top;
 	int w = _dstRect.width() / _transform._numTimesX;
@@ -124,7 +142,7 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
 	for (int ry = 0; ry < _transform._numTimesY; ++ry) {
 		int x = _dstRect.left;
 		for (int rx = 0; rx < _transform._numTimesX; ++rx) {
-			src.blendBlitTo(*_targetSurface, x, y, _transform._flip, &clipRect, _transform._rgbaMod, clipRect.width(), clipRect.height(),
+			_surface.blendBlitTo(*_targetSurface, x, y, _transform._flip, &clipRect, _transform._rgbaMod, clipRect.width(), clipRect.height(),
 				Graphics::BLEND_NORMAL, alphaMode);
 			x += w;
 		}
@@ -132,33 +150,19 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
 	}
 }
 
-void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect) const {
-	Graphics::ManagedSurface src;
-	src.copyFrom(*getSurface());
-
-	bool doDelete = false;
+void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect) {
+	Common::Rect fullRect;
 	if (!clipRect) {
-		doDelete = true;
-		clipRect = new Common::Rect();
-		clipRect->setWidth(getSurface()->w * _transform._numTimesX);
-		clipRect->setHeight(getSurface()->h * _transform._numTimesY);
+		fullRect.setWidth(_surface.w * _transform._numTimesX);
+		fullRect.setHeight(_surface.h * _transform._numTimesY);
+		clipRect = &fullRect;
 	}
 
-	Graphics::AlphaType alphaMode = Graphics::ALPHA_FULL;
-
-	if (_owner) {
-		if (_transform._alphaDisable) {
-			alphaMode = Graphics::ALPHA_OPAQUE;
-		} else if (_transform._angle) {
-			alphaMode = Graphics::ALPHA_FULL;
-		} else {
-			alphaMode = _owner->getAlphaType();
-		}
-	}
+	Graphics::AlphaType alphaMode = getAlphaType();
 
 	if (_transform._numTimesX * _transform._numTimesY == 1) {
 
-		src.blendBlitTo(*_targetSurface, dstRect->left, dstRect->top, _transform._flip, clipRect, _transform._rgbaMod, clipRect->width(),
+		_surface.blendBlitTo(*_targetSurface, dstRect->left, dstRect->top, _transform._flip, clipRect, _transform._rgbaMod, clipRect->width(),
 			clipRect->height(), _transform._blendMode, alphaMode);
 
 	} else {
@@ -167,8 +171,8 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface, Common::Rect
 		Common::Rect subRect;
 
 		int y = 0;
-		int w = getSurface()->w;
-		int h = getSurface()->h;
+		int w = _surface.w;
+		int h = _surface.h;
 		assert(w == _dstRect.width() / _transform._numTimesX);
 		assert(h == _dstRect.height() / _transform._numTimesY);
 
@@ -187,7 +191,7 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface, Common::Rect
 				if (subRect.intersects(*clipRect)) {
 					subRect.clip(*clipRect);
 					subRect.translate(-x, -y);
-					src.blendBlitTo(*_targetSurface, basex + x + subRect.left, basey + y + subRect.top, _transform._flip, &subRect,
+					_surface.blendBlitTo(*_targetSurface, basex + x + subRect.left, basey + y + subRect.top, _transform._flip, &subRect,
 						_transform._rgbaMod, subRect.width(), subRect.height(), _transform._blendMode, alphaMode);
 
 				}
@@ -197,10 +201,6 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface, Common::Rect
 			y += h;
 		}
 	}
-
-	if (doDelete) {
-		delete clipRect;
-	}
 }
 
 } // End of namespace Wintermute
@@ -28,6 +28,7 @@
 #ifndef WINTERMUTE_RENDER_TICKET_H
 #define WINTERMUTE_RENDER_TICKET_H
 
+#include "graphics/managed_surface.h"
 #include "graphics/surface.h"
 
 #include "common/rect.h"
@@ -51,13 +52,18 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _owner(nullptr), _hash(0) {}
 	~RenderTicket();
-	const Graphics::Surface *getSurface() const { return _surface; }
+	/**
+	 * Reinitialize a pooled ticket for a new draw-call. The pixel buffer
+	 * of the previous call is kept when the new copy fits its size.
+	 */
+	void reset(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform);
+	const Graphics::Surface *getSurface() const { return &_surface.rawSurface(); }
 	// Non-dirty-rects:
-	void drawToSurface(Graphics::Surface *_targetSurface) const;
+	void drawToSurface(Graphics::Surface *_targetSurface);
 	// Dirty-rects:
-	void drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect) const;
+	void drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect);
 
 	Common::Rect _dstRect;
 
@@ -68,10 +74,19 @@ public:
 
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
+	/**
+	 * Hash of everything operator== compares, used to find the ticket
+	 * of the same draw-call from last frame.
+	 */
+	uint32 getHash() const { return _hash; }
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
-	Graphics::Surface *_surface;
+	Graphics::AlphaType getAlphaType() const;
+
+	// Blitted from directly, no copy is made per frame
+	Graphics::ManagedSurface _surface;
 	Common::Rect _srcRect;
+	uint32 _hash;
 };
 
 } // End of namespace Wintermute
@@ -188,6 +188,11 @@ bool ScScript::initTables() {
 		_symbols[index] = getString();
 	}
 
+	TVarCacheEntry emptyEntry;
+	memset(&emptyEntry, 0, sizeof(emptyEntry));
+	_varCache.clear();
+	_varCache.resize(_numSymbols, emptyEntry);
+
 	// load functions table
 	_iP = _header.funcTable;
 
@@ -396,6 +401,7 @@ void ScScript::cleanup() {
 	}
 	_symbols = nullptr;
 	_numSymbols = 0;
+	_varCache.clear();
 
 	if (_globals && !_thread) {
 		delete _globals;
@@ -468,18 +474,24 @@ void ScScript::cleanup() {
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getDWORD() {
-	_scriptStream->seek((int32)_iP);
-	uint32 ret = _scriptStream->readUint32LE();
+	// Operands are read straight from the compiled code, the stream is
+	// only needed for the header
+	uint32 ret = 0;
+	if (_bufferSize >= sizeof(uint32) && _iP <= _bufferSize - sizeof(uint32)) {
+		ret = READ_LE_UINT32(_buffer + _iP);
+	}
 	_iP += sizeof(uint32);
-//	assert(oldRet == ret);
 	return ret;
 }
 
 //////////////////////////////////////////////////////////////////////////
 double ScScript::getFloat() {
-	_scriptStream->seek((int32)_iP);
 	byte buffer[8];
-	_scriptStream->read(buffer, 8);
+	if (_bufferSize >= 8 && _iP <= _bufferSize - 8) {
+		memcpy(buffer, _buffer + _iP, 8);
+	} else {
+		memset(buffer, 0, 8);
+	}
 
 #ifdef SCUMM_BIG_ENDIAN
 	// TODO: For lack of a READ_LE_UINT64
@@ -503,7 +515,6 @@ char *ScScript::getString() {
 		_iP++;
 	}
 	_iP++; // string terminator
-	_scriptStream->seek(_iP);
 
 	return ret;
 }
@@ -742,7 +753,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getSymbolVar(getDWORD());
 		// Disabled in original code
 		/*if (false && var->_type==VAL_OBJECT || var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
@@ -754,15 +765,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getSymbolVar(getDWORD());
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getSymbolVar(getDWORD());
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -813,7 +823,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getSymbolVar(getDWORD()));
 		_thisStack->push(_operand);
 		break;
 
@@ -1171,29 +1181,42 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+static inline bool isPlainScope(ScValue *scope) {
+	return scope->_type == VAL_OBJECT || scope->_type == VAL_NULL;
+}
+
+// Same as propExists() followed by getProp(), with a single lookup for
+// the plain objects the scopes normally are
+static ScValue *findVar(ScValue *scope, const char *name) {
+	if (isPlainScope(scope)) {
+		Common::HashMap<Common::String, ScValue *>::const_iterator it = scope->_valObject.find(name);
+		return it != scope->_valObject.end() ? it->_value : nullptr;
+	}
+
+	if (scope->propExists(name)) {
+		return scope->getProp(name);
+	}
+	return nullptr;
+}
+
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScScript::getVar(char *name) {
 	ScValue *ret = nullptr;
 
 	// scope locals
 	if (_scopeStack->_sP >= 0) {
-		if (_scopeStack->getTop()->propExists(name)) {
-			ret = _scopeStack->getTop()->getProp(name);
-		}
+		ret = findVar(_scopeStack->getTop(), name);
 	}
 
 	// script globals
 	if (ret == nullptr) {
-		if (_globals->propExists(name)) {
-			ret = _globals->getProp(name);
-		}
+		ret = findVar(_globals, name);
 	}
 
 	// engine globals
 	if (ret == nullptr) {
-		if (_engine->_globals->propExists(name)) {
-			ret = _engine->_globals->getProp(name);
-		}
+		ret = findVar(_engine->_globals, name);
 	}
 
 	if (ret == nullptr) {
@@ -1215,6 +1238,73 @@ ScValue *ScScript::getVar(char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+// Resolves the variable of a PUSH_VAR/POP_VAR/PUSH_THIS operand. The answer
+// of the last lookup is reused as long as none of the scopes it searched
+// had members added or removed since. When only the local scope changed,
+// as it does on every call, a variable found further out just needs to
+// be checked for being shadowed.
+ScValue *ScScript::getSymbolVar(uint32 symbol) {
+	if (symbol >= _varCache.size()) {
+		return getVar(_symbols[symbol]);
+	}
+
+	ScValue *holders[3];
+	holders[0] = _scopeStack->_sP >= 0 ? _scopeStack->getTop() : nullptr;
+	holders[1] = _globals;
+	holders[2] = _engine->_globals;
+
+	TVarCacheEntry &entry = _varCache[symbol];
+	if (entry.value) {
+		int32 stale = -1;
+		for (int32 i = entry.level; i >= 0; i--) {
+			ScValue *holder = holders[i];
+			if (holder != entry.holders[i] || (holder && (!isPlainScope(holder) || holder->_propsStamp != entry.stamps[i]))) {
+				stale = i;
+				break;
+			}
+		}
+
+		if (stale < 0) {
+			return entry.value;
+		}
+
+		if (stale == 0 && entry.level > 0 && holders[0] && isPlainScope(holders[0]) && !findVar(holders[0], _symbols[symbol])) {
+			entry.holders[0] = holders[0];
+			entry.stamps[0] = holders[0]->_propsStamp;
+			return entry.value;
+		}
+	}
+
+	entry.value = nullptr;
+	for (int32 i = 0; i < 3; i++) {
+		ScValue *holder = holders[i];
+		if (!holder) {
+			entry.holders[i] = nullptr;
+			entry.stamps[i] = 0;
+			continue;
+		}
+		if (!isPlainScope(holder)) {
+			break;
+		}
+
+		entry.holders[i] = holder;
+		entry.stamps[i] = holder->_propsStamp;
+
+		ScValue *value = findVar(holder, _symbols[symbol]);
+		if (value) {
+			entry.value = value;
+			entry.level = i;
+			return value;
+		}
+	}
+
+	// Not found, or searched an unusual scope: take the slow path, which
+	// also creates missing variables
+	return getVar(_symbols[symbol]);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::waitFor(BaseObject *object) {
 	if (_unbreakable) {
@@ -79,6 +79,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getSymbolVar(uint32 symbol);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -161,6 +162,17 @@ private:
 	uint32 _numMethods;
 	uint32 _numEvents;
 
+	// Where each symbol was last resolved by getSymbolVar(), along with
+	// the scopes that were searched and their ScValue::_propsStamp.
+	typedef struct {
+		ScValue *value;
+		int32 level;
+		ScValue *holders[3];
+		uint32 stamps[3];
+	} TVarCacheEntry;
+
+	Common::Array<TVarCacheEntry> _varCache;
+
 	bool initScript();
 	bool initTables();
 
@@ -41,8 +41,11 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScValue, false)
 
+uint32 ScValue::_propsStampCounter = 0;
+
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
+	_propsStamp = ++_propsStampCounter;
 	_type = VAL_NULL;
 
 	_valBool = false;
@@ -58,6 +61,7 @@ ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame, bool val) : BaseClass(inGame) {
+	_propsStamp = ++_propsStampCounter;
 	_type = VAL_BOOL;
 	_valBool = val;
 
@@ -73,6 +77,7 @@ ScValue::ScValue(BaseGame *inGame, bool val) : BaseClass(inGame) {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame, int32 val) : BaseClass(inGame) {
+	_propsStamp = ++_propsStampCounter;
 	_type = VAL_INT;
 	_valInt = val;
 
@@ -88,6 +93,7 @@ ScValue::ScValue(BaseGame *inGame, int32 val) : BaseClass(inGame) {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
+	_propsStamp = ++_propsStampCounter;
 	_type = VAL_FLOAT;
 	_valFloat = val;
 
@@ -103,6 +109,7 @@ ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
+	_propsStamp = ++_propsStampCounter;
 	_type = VAL_STRING;
 	_valString = nullptr;
 	setStringVal(val);
@@ -200,6 +207,7 @@ bool ScValue::deleteProp(const char *name) {
 	if (_valIter != _valObject.end()) {
 		delete _valIter->_value;
 		_valIter->_value = nullptr;
+		_propsStamp = ++_propsStampCounter;
 	}
 
 	return STATUS_OK;
@@ -227,6 +235,7 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
+			_propsStamp = ++_propsStampCounter;
 		} else {
 			newVal->cleanup();
 		}
@@ -277,6 +286,7 @@ void ScValue::deleteProps() {
 		_valIter++;
 	}
 	_valObject.clear();
+	_propsStamp = ++_propsStampCounter;
 }
 
 
@@ -745,6 +755,7 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	} else {
 		_valObject.clear();
 	}
+	_propsStamp = ++_propsStampCounter;
 }
 
 
@@ -817,6 +828,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 			_valObject[str] = val;
 			delete[] str;
 		}
+		_propsStamp = ++_propsStampCounter;
 	}
 
 	persistMgr->transferPtr(TMEMBER_PTR(_valRef));
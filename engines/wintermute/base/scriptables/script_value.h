@@ -100,6 +100,11 @@ public:
 	Common::HashMap<Common::String, ScValue *> _valObject;
 	Common::HashMap<Common::String, ScValue *>::iterator _valIter;
 
+	// Renewed whenever a member is added to or removed from _valObject,
+	// so the ScValue pointers found there can be cached by the scripts.
+	uint32 _propsStamp;
+	static uint32 _propsStampCounter;
+
 	bool setProperty(const char *propName, int32 value);
 	bool setProperty(const char *propName, const char *value);
 	bool setProperty(const char *propName, double value);
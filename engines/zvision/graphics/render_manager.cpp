@@ -115,9 +115,8 @@ void RenderManager::renderSceneToScreen() {
 	RenderTable::RenderState state = _renderTable.getRenderState();
 	if (state == RenderTable::PANORAMA || state == RenderTable::TILT) {
 		if (!_backgroundSurfaceDirtyRect.isEmpty()) {
-			_renderTable.mutateImage(&_warpedSceneSurface, in);
+			outWndDirtyRect = _renderTable.mutateImage(&_warpedSceneSurface, in, _backgroundSurfaceDirtyRect);
 			out = &_warpedSceneSurface;
-			outWndDirtyRect = Common::Rect(_workingWindow.width(), _workingWindow.height());
 		}
 	} else {
 		out = in;
@@ -783,6 +782,8 @@ void RenderManager::deleteEffect(uint32 ID) {
 		if ((*it)->getKey() == ID) {
 			delete *it;
 			it = _effects.erase(it);
+			// Redraw what the effect covered, the scene is only warped where it changes
+			_backgroundDirtyRect = Common::Rect(_backgroundWidth, _backgroundHeight);
 		}
 	}
 }
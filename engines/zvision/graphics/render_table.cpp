@@ -30,21 +30,26 @@ namespace ZVision {
 RenderTable::RenderTable(uint numColumns, uint numRows)
 	: _numRows(numRows),
 	  _numColumns(numColumns),
-	  _renderState(FLAT) {
+	  _renderState(FLAT),
+	  _tableState(FLAT),
+	  _warpValid(false) {
 	assert(numRows != 0 && numColumns != 0);
 
-	_internalBuffer = new Common::Point[numRows * numColumns];
+	_lineOffsets = new int16[MAX(numRows, numColumns)]();
+	_pixelOffsets = new int16[numRows * numColumns]();
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
 }
 
 RenderTable::~RenderTable() {
-	delete[] _internalBuffer;
+	delete[] _lineOffsets;
+	delete[] _pixelOffsets;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
 	_renderState = newState;
+	_warpValid = false;
 
 	switch (newState) {
 	case PANORAMA:
@@ -77,56 +82,92 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 	uint32 index = point.y * _numColumns + point.x;
 
 	Common::Point newPoint(point);
-	newPoint.x += _internalBuffer[index].x;
-	newPoint.y += _internalBuffer[index].y;
+	if (_tableState == TILT) {
+		newPoint.x += _pixelOffsets[index];
+		newPoint.y += _lineOffsets[point.y];
+	} else {
+		newPoint.x += _lineOffsets[point.x];
+		newPoint.y += _pixelOffsets[index];
+	}
 
 	return newPoint;
 }
 
-void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
-
-	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+// Warps the pixels of rect, destBuffer points to the first one of them
+void RenderTable::warpRect(const uint16 *sourceBuffer, uint16 *destBuffer, uint32 destPitch, const Common::Rect &rect) {
+	for (int16 y = rect.top; y < rect.bottom; ++y) {
+		// RenderTable only stores offsets from the original coordinates
+		const int16 *pixelOffsets = _pixelOffsets + y * _numColumns;
 
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+		if (_tableState == TILT) {
+			const uint16 *sourceRow = sourceBuffer + (y + _lineOffsets[y]) * _numColumns;
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
+			for (int16 x = rect.left; x < rect.right; ++x)
+				destBuffer[x - rect.left] = sourceRow[x + pixelOffsets[x]];
+		} else {
+			for (int16 x = rect.left; x < rect.right; ++x)
+				destBuffer[x - rect.left] = sourceBuffer[(y + pixelOffsets[x]) * _numColumns + x + _lineOffsets[x]];
 		}
 
-		destOffset += destWidth;
+		destBuffer += destPitch;
 	}
 }
 
-void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
+// Finds the lines of the warped image that take any pixel from srcDirtyRect
+Common::Rect RenderTable::getWarpedDirtyRect(const Common::Rect &srcDirtyRect) {
+	Common::Rect warped(_numColumns, _numRows);
 
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
-	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
+	if (_tableState == TILT) {
+		int16 top = -1, bottom = -1;
+		for (uint y = 0; y < _numRows; ++y) {
+			int16 sourceY = y + _lineOffsets[y];
+			if (sourceY >= srcDirtyRect.top && sourceY < srcDirtyRect.bottom) {
+				if (top < 0)
+					top = y;
+				bottom = y + 1;
+			}
+		}
+		warped.top = MAX<int16>(top, 0);
+		warped.bottom = MAX<int16>(bottom, 0);
+	} else {
+		int16 left = -1, right = -1;
+		for (uint x = 0; x < _numColumns; ++x) {
+			int16 sourceX = x + _lineOffsets[x];
+			if (sourceX >= srcDirtyRect.left && sourceX < srcDirtyRect.right) {
+				if (left < 0)
+					left = x;
+				right = x + 1;
+			}
+		}
+		warped.left = MAX<int16>(left, 0);
+		warped.right = MAX<int16>(right, 0);
+	}
 
-	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+	return warped;
+}
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
+	warpRect(sourceBuffer, destBuffer, destWidth, subRect);
+}
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+// Returns the part of dstBuf that was updated
+Common::Rect RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect) {
+	assert(srcBuf->w == (int16)_numColumns && srcBuf->h == (int16)_numRows);
 
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
-		}
-	}
+	Common::Rect rect(srcBuf->w, srcBuf->h);
+	if (_warpValid)
+		rect = getWarpedDirtyRect(srcDirtyRect);
+
+	if (!rect.isEmpty())
+		warpRect((const uint16 *)srcBuf->getPixels(), (uint16 *)dstBuf->getBasePtr(rect.left, rect.top), dstBuf->pitch / 2, rect);
+
+	_warpValid = true;
+	return rect;
 }
 
 void RenderTable::generateRenderTable() {
+	_warpValid = false;
+
 	switch (_renderState) {
 	case ZVision::RenderTable::PANORAMA:
 		generatePanoramaLookupTable();
@@ -143,13 +184,7 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	for (uint y = 0; y < _numRows; y++) {
-		for (uint x = 0; x < _numColumns; x++) {
-			uint32 index = y * _numColumns + x;
-			_internalBuffer[index].x = 0;
-			_internalBuffer[index].y = 0;
-		}
-	}
+	_tableState = PANORAMA;
 
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
@@ -168,6 +203,9 @@ void RenderTable::generatePanoramaLookupTable() {
 
 		float cosAlpha = cos(alpha);
 
+		// Only store the (x,y) offsets instead of the absolute positions
+		_lineOffsets[x] = xInCylinderCoords - x;
+
 		for (uint y = 0; y < _numRows; ++y) {
 			// To calculate y in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
@@ -175,14 +213,14 @@ void RenderTable::generatePanoramaLookupTable() {
 
 			uint32 index = y * _numColumns + x;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			_pixelOffsets[index] = yInCylinderCoords - y;
 		}
 	}
 }
 
 void RenderTable::generateTiltLookupTable() {
+	_tableState = TILT;
+
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -203,6 +241,9 @@ void RenderTable::generateTiltLookupTable() {
 		float cosAlpha = cos(alpha);
 		uint32 columnIndex = y * _numColumns;
 
+		// Only store the (x,y) offsets instead of the absolute positions
+		_lineOffsets[y] = yInCylinderCoords - y;
+
 		for (uint x = 0; x < _numColumns; ++x) {
 			// To calculate x in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
@@ -210,9 +251,7 @@ void RenderTable::generateTiltLookupTable() {
 
 			uint32 index = columnIndex + x;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			_pixelOffsets[index] = xInCylinderCoords - x;
 		}
 	}
 }
@@ -41,9 +41,21 @@ public:
 
 private:
 	uint _numColumns, _numRows;
-	Common::Point *_internalBuffer;
 	RenderState _renderState;
 
+	// Both warps are separable: a panorama shifts whole columns sideways
+	// and scales each of them vertically, a tilt shifts whole rows and
+	// scales each of them horizontally. The table keeps one offset per
+	// shifted line and one offset per pixel along the scaled axis.
+	int16 *_lineOffsets;  // per column in a panorama, per row in a tilt
+	int16 *_pixelOffsets; // _numRows * _numColumns
+	RenderState _tableState; // the layout the offsets were generated for
+
+	// Whether the last destination of mutateImage() holds the full warp of
+	// the current table, so that only the parts of it coming from dirty
+	// source pixels have to be warped again
+	bool _warpValid;
+
 	struct {
 		float fieldOfView;
 		float linearScale;
@@ -68,7 +80,7 @@ public:
 	const Common::Point convertWarpedCoordToFlatCoord(const Common::Point &point);
 
 	void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
-	void mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf);
+	Common::Rect mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect);
 	void generateRenderTable();
 
 	void setPanoramaFoV(float fov);
@@ -87,6 +99,9 @@ public:
 	float getLinscale();
 
 private:
+	void warpRect(const uint16 *sourceBuffer, uint16 *destBuffer, uint32 destPitch, const Common::Rect &rect);
+	Common::Rect getWarpedDirtyRect(const Common::Rect &srcDirtyRect);
+
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
 };